@@ -0,0 +1,60 @@
+// AlignedBuffer.h - Declares the AlignedBuffer type and its allocator.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIN_DATA_ALIGNED_BUFFER_H
+#define BIN_DATA_ALIGNED_BUFFER_H
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <memory>
+
+namespace BinData
+{
+    /// @brief The alignment of buffers that need no particular alignment.
+    constexpr std::size_t defaultAlignment{ alignof(std::max_align_t) };
+
+    /// @brief Frees a buffer allocated by AllocateAligned().
+    struct AlignedDelete
+    {
+        /// @brief The alignment the buffer was allocated with.
+        std::size_t alignment{ defaultAlignment };
+
+        void operator()(char* p) const
+        {
+            ::operator delete[](p, std::align_val_t{ alignment });
+        }
+    };
+
+    /// @brief An owning pointer to a buffer with a known alignment.
+    using AlignedBuffer = std::unique_ptr<char[], AlignedDelete>;
+
+    /// @brief Allocates a zero filled buffer at the specified alignment.
+    /// @param size The size of the buffer, in bytes.
+    /// @param alignment The alignment of the buffer, which must be a power
+    /// of two.
+    /// @return The buffer.
+    inline AlignedBuffer AllocateAligned(std::size_t size, 
+        std::size_t alignment = defaultAlignment)
+    {
+        auto data = static_cast<char*>(
+            ::operator new[](size, std::align_val_t{ alignment }));
+        std::memset(data, 0, size);
+        return AlignedBuffer{ data, AlignedDelete{ alignment } };
+    }
+}
+
+#endif
@@ -0,0 +1,95 @@
+// AsyncEngine.h - Declares the AsyncEngine abstract class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIN_DATA_ASYNC_ENGINE_H
+#define BIN_DATA_ASYNC_ENGINE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace BinData
+{
+    /// @brief A single positional read or write for an AsyncEngine.
+    struct AsyncRequest
+    {
+        /// @brief The caller's identifier, returned with the result.
+        std::uint64_t id;
+
+        /// @brief True for a write, false for a read.
+        bool isWrite;
+
+        /// @brief The file descriptor to read from or write to.
+        int descriptor;
+
+        /// @brief The buffer to read into or write from.
+        char* data;
+
+        /// @brief The number of bytes to transfer.
+        std::size_t size;
+
+        /// @brief The offset within the file to transfer at.
+        std::size_t offset;
+    };
+
+    /// @brief The outcome of an AsyncRequest.
+    struct AsyncResult
+    {
+        /// @brief The identifier of the request.
+        std::uint64_t id;
+
+        /// @brief The number of bytes transferred, or a negated errno value.
+        long result;
+    };
+
+    /// @brief Performs batches of positional I/O asynchronously.
+    ///
+    /// Requests are queued with Enqueue(), handed to the engine together
+    /// with Submit() and their results collected with Reap(). This is the
+    /// interface AsyncFileStream uses to switch between io_uring and its
+    /// thread pool fallback.
+    class AsyncEngine
+    {
+    public:
+        virtual ~AsyncEngine() = default;
+
+        /// @brief Queues a request, submitting earlier ones if necessary.
+        /// @param request The request to queue.
+        virtual void Enqueue(const AsyncRequest& request) = 0;
+
+        /// @brief Submits every queued request.
+        /// @return The number of requests submitted.
+        virtual std::size_t Submit() = 0;
+
+        /// @brief Collects the results of completed requests.
+        ///
+        /// Queued requests are submitted first. Then, every result that is
+        /// already available is appended, waiting until at least 
+        /// minResults are available or no requests remain in flight.
+        ///
+        /// @param results The vector to append the results to.
+        /// @param minResults The minimum number of results to wait for.
+        /// @return The number of results appended.
+        virtual std::size_t Reap(std::vector<AsyncResult>& results,
+            std::size_t minResults) = 0;
+
+        /// @brief Gets the number of requests that have not been reaped.
+        /// @return The number of queued and in flight requests.
+        virtual std::size_t Pending() const = 0;
+    };
+}
+
+#endif
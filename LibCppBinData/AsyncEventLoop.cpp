@@ -0,0 +1,99 @@
+// AsyncEventLoop.cpp - Defines the AsyncEventLoop class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "AsyncEventLoop.h"
+
+#ifdef BIN_DATA_COROUTINES
+
+namespace BinData
+{
+    void AsyncEventLoop::Spawn(Task<void> task)
+    {
+        mReady.push_back(task.handle);
+        mTasks.push_back(std::move(task));
+    }
+
+    void AsyncEventLoop::Run()
+    {
+        while (true)
+        {
+            while (!mReady.empty())
+            {
+                std::coroutine_handle<> handle = mReady.front();
+                mReady.pop_front();
+                handle.resume();
+            }
+
+            // Every stream is checked without blocking so that no task is
+            // held up behind another stream's requests. Only when nothing
+            // at all has completed does the loop block, on any one stream.
+            bool isProgressing = false;
+            for (auto& [stream, waiters] : mWaiters)
+            {
+                if (!waiters.empty())
+                    isProgressing = Poll(stream, 0) || isProgressing;
+            }
+
+            if (!isProgressing)
+            {
+                auto waiting = mWaiters.begin();
+                while (waiting != mWaiters.end() && waiting->second.empty())
+                    waiting = mWaiters.erase(waiting);
+                if (waiting == mWaiters.end())
+                    break;
+                Poll(waiting->first, 1);
+            }
+        }
+
+        // Only the tasks are destroyed here; their exceptions have to be
+        // found before that happens.
+        std::vector<Task<void>> tasks = std::move(mTasks);
+        mTasks.clear();
+        for (Task<void>& task : tasks)
+            task.Result();
+    }
+
+    void AsyncEventLoop::Await(AsyncFileStream* stream, std::uint64_t id, 
+        AsyncCompletion* completion, std::coroutine_handle<> handle)
+    {
+        mWaiters[stream][id] = Waiter{ completion, handle };
+    }
+
+    bool AsyncEventLoop::Poll(AsyncFileStream* stream, 
+        std::size_t minCompletions)
+    {
+        mCompletions.clear();
+        stream->Reap(mCompletions, minCompletions);
+
+        std::unordered_map<std::uint64_t, Waiter>& waiters = mWaiters[stream];
+        bool isProgressing = false;
+        for (const AsyncCompletion& completion : mCompletions)
+        {
+            auto waiter = waiters.find(completion.id);
+            if (waiter == waiters.end())
+                continue;
+
+            *waiter->second.completion = completion;
+            mReady.push_back(waiter->second.handle);
+            waiters.erase(waiter);
+            isProgressing = true;
+        }
+
+        return isProgressing;
+    }
+}
+
+#endif
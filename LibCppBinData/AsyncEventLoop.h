@@ -0,0 +1,90 @@
+// AsyncEventLoop.h - Declares the AsyncEventLoop class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIN_DATA_ASYNC_EVENT_LOOP_H
+#define BIN_DATA_ASYNC_EVENT_LOOP_H
+
+#ifdef BIN_DATA_COROUTINES
+
+#include <cstdint>
+#include <coroutine>
+#include <deque>
+#include <vector>
+#include <unordered_map>
+#include "Task.h"
+#include "AsyncFileStream.h"
+
+namespace BinData
+{
+    /// @brief Runs coroutines that wait on AsyncFileStream requests.
+    ///
+    /// Tasks handed to Spawn() are started by Run(), which resumes each one
+    /// whenever the request it is waiting on completes. Requests from every
+    /// task are kept in flight at once, so thousands of file parses can be
+    /// multiplexed on the thread running the loop rather than blocking a
+    /// thread each. To use more threads, run one loop per thread.
+    ///
+    /// A loop must only be used from the thread that runs it.
+    class AsyncEventLoop
+    {
+    public:
+        AsyncEventLoop() = default;
+
+        AsyncEventLoop(const AsyncEventLoop&) = delete;
+
+        AsyncEventLoop& operator=(const AsyncEventLoop&) = delete;
+
+        /// @brief Adds a task to be started by the next call to Run().
+        /// @param task The task to run.
+        void Spawn(Task<void> task);
+
+        /// @brief Runs every spawned task to completion.
+        ///
+        /// If any task ended with an exception, the first such exception 
+        /// is rethrown once every task has finished.
+        void Run();
+
+        /// @brief Suspends a coroutine until a queued request completes.
+        ///
+        /// This is used by awaitables such as AsyncRawFile::ReadAsync() and
+        /// is not normally called directly.
+        ///
+        /// @param stream The stream the request was queued on.
+        /// @param id The identifier of the request.
+        /// @param completion Where to store the request's completion.
+        /// @param handle The coroutine to resume once it completes.
+        void Await(AsyncFileStream* stream, std::uint64_t id, 
+            AsyncCompletion* completion, std::coroutine_handle<> handle);
+    private:
+        struct Waiter
+        {
+            AsyncCompletion* completion;
+            std::coroutine_handle<> handle;
+        };
+
+        std::vector<Task<void>> mTasks;
+        std::deque<std::coroutine_handle<>> mReady;
+        std::unordered_map<AsyncFileStream*, 
+            std::unordered_map<std::uint64_t, Waiter>> mWaiters;
+        std::vector<AsyncCompletion> mCompletions;
+
+        bool Poll(AsyncFileStream* stream, std::size_t minCompletions);
+    };
+}
+
+#endif
+
+#endif
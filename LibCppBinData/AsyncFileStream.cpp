@@ -0,0 +1,173 @@
+// AsyncFileStream.cpp - Defines the AsyncFileStream class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdexcept>
+#include <algorithm>
+#include <thread>
+#include "AsyncFileStream.h"
+#include "ThreadPoolEngine.h"
+
+#ifdef BIN_DATA_IO_URING
+#include "IoUringEngine.h"
+#endif
+
+namespace BinData
+{
+    AsyncFileStream::AsyncFileStream(std::string fileName, 
+        AsyncBackend backend, std::size_t queueDepth)
+        : PosixFileStream{ fileName }, mBackend{ backend }, 
+        mQueueDepth{ std::max<std::size_t>(queueDepth, 1) }, mNextID{ 0 }
+    {
+
+    }
+
+    AsyncFileStream::~AsyncFileStream()
+    {
+        // The base destructor would only close the descriptor, so the
+        // backend has to be shut down here while it is still valid.
+        if (IsOpen())
+            Close();
+    }
+
+    void AsyncFileStream::Open(FileMode m)
+    {
+        PosixFileStream::Open(m);
+
+        try
+        {
+#ifdef BIN_DATA_IO_URING
+            bool useIoUring = mBackend == AsyncBackend::IoUring ||
+                (mBackend == AsyncBackend::Auto && IoUringEngine::IsSupported());
+            if (useIoUring)
+            {
+                mEngine = std::make_unique<IoUringEngine>(mQueueDepth);
+                mBackend = AsyncBackend::IoUring;
+                return;
+            }
+#else
+            if (mBackend == AsyncBackend::IoUring)
+                throw std::runtime_error{ "io_uring is not available" };
+#endif
+
+            // The workers mostly wait on the device, so there is little to
+            // gain from more of them than the hardware can keep busy.
+            std::size_t threads = std::max(std::thread::hardware_concurrency(), 
+                4u);
+            mEngine = std::make_unique<ThreadPoolEngine>(
+                std::min(mQueueDepth, threads));
+            mBackend = AsyncBackend::ThreadPool;
+        }
+        catch (...)
+        {
+            PosixFileStream::Close();
+            throw;
+        }
+    }
+
+    void AsyncFileStream::Close()
+    {
+        // Destroying the engine waits for anything still in flight, since
+        // the kernel may be using the caller's buffers and the descriptor.
+        mEngine = nullptr;
+        mRequests.clear();
+        PosixFileStream::Close();
+    }
+
+    std::uint64_t AsyncFileStream::EnqueueRead(std::size_t offset, Field* f)
+    {
+        if (Mode() == FileMode::Write || Mode() == FileMode::WriteAppend)
+            throw std::runtime_error{ "File is not open for reading" };
+        return Enqueue(offset, f, false);
+    }
+
+    std::uint64_t AsyncFileStream::EnqueueWrite(std::size_t offset, Field* f)
+    {
+        if (Mode() == FileMode::Read)
+            throw std::runtime_error{ "File is not open for writing" };
+        return Enqueue(offset, f, true);
+    }
+
+    std::size_t AsyncFileStream::Submit()
+    {
+        if (mEngine == nullptr)
+            return 0;
+        return mEngine->Submit();
+    }
+
+    std::size_t AsyncFileStream::Reap(std::vector<AsyncCompletion>& completions,
+        std::size_t minCompletions)
+    {
+        if (mEngine == nullptr)
+            return 0;
+
+        mResults.clear();
+        std::size_t count = mEngine->Reap(mResults, minCompletions);
+        for (const AsyncResult& result : mResults)
+        {
+            auto request = mRequests.find(result.id);
+            if (request == mRequests.end())
+            {
+                count--;
+                continue;
+            }
+
+            AsyncCompletion completion;
+            completion.id = result.id;
+            completion.field = request->second.field;
+            completion.offset = request->second.offset;
+            completion.bytes = result.result > 0 ? 
+                static_cast<std::size_t>(result.result) : 0;
+            completion.error = result.result < 0 ? 
+                static_cast<int>(-result.result) : 0;
+
+            if (request->second.isWrite && completion.bytes > 0)
+                GrowSize(completion.offset + completion.bytes);
+
+            completions.push_back(completion);
+            mRequests.erase(request);
+        }
+
+        return count;
+    }
+
+    std::uint64_t AsyncFileStream::Enqueue(std::size_t offset, Field* f, 
+        bool isWrite)
+    {
+        if (mEngine == nullptr)
+            throw std::runtime_error{ "File is not open" };
+
+        std::uint64_t id = mNextID++;
+        AsyncRequest request;
+        request.id = id;
+        request.isWrite = isWrite;
+        request.descriptor = Descriptor();
+        request.data = f->Data();
+        request.size = f->Size();
+        request.offset = offset;
+
+        mRequests[id] = Request{ f, offset, isWrite };
+        try
+        {
+            mEngine->Enqueue(request);
+        }
+        catch (...)
+        {
+            mRequests.erase(id);
+            throw;
+        }
+        return id;
+    }
+}
@@ -0,0 +1,181 @@
+// AsyncFileStream.h - Declares the AsyncFileStream class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIN_DATA_ASYNC_FILE_STREAM_H
+#define BIN_DATA_ASYNC_FILE_STREAM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include "PosixFileStream.h"
+#include "AsyncEngine.h"
+
+namespace BinData
+{
+    /// @brief The mechanism an AsyncFileStream uses to perform its I/O.
+    enum class AsyncBackend
+    {
+        /// @brief Use io_uring if the kernel supports it, else ThreadPool.
+        Auto,
+
+        /// @brief Use io_uring (Linux 5.6 or later).
+        IoUring,
+
+        /// @brief Use pread()/pwrite() on a pool of worker threads.
+        ThreadPool
+    };
+
+    /// @brief The outcome of a read or write queued on an AsyncFileStream.
+    struct AsyncCompletion
+    {
+        /// @brief The identifier returned when the request was queued.
+        std::uint64_t id;
+
+        /// @brief The field that was read into or written from.
+        Field* field;
+
+        /// @brief The offset the request was made at.
+        std::size_t offset;
+
+        /// @brief The number of bytes transferred.
+        std::size_t bytes;
+
+        /// @brief The errno value if the request failed, otherwise 0.
+        int error;
+
+        /// @brief Determines if the whole field was transferred.
+        /// @return True if the request succeeded in full.
+        bool Succeeded() const
+        {
+            return error == 0 && bytes == field->Size();
+        }
+    };
+
+    /// @brief A PosixFileStream that can also queue reads and writes.
+    ///
+    /// In addition to the synchronous FileStream interface, any number of
+    /// positional reads and writes can be queued with EnqueueRead() and
+    /// EnqueueWrite(), handed to the kernel together with Submit(), and 
+    /// their completions collected in batches with Reap(). This keeps many
+    /// requests in flight at once, which a device like an NVMe drive needs
+    /// to reach its full throughput.
+    ///
+    /// On Linux 5.6 or later the requests are performed by io_uring. When it
+    /// is unavailable, a pool of threads performing pread()/pwrite() is used
+    /// instead, so code written against this class works everywhere.
+    ///
+    /// A queued field must stay alive, and must not be otherwise used, 
+    /// until its completion has been reaped. The queueing methods must all 
+    /// be called from the same thread.
+    ///
+    /// @remark This class is only available on POSIX platforms.
+    class AsyncFileStream : public PosixFileStream
+    {
+    public:
+        /// @brief Constructs a new AsyncFileStream.
+        /// @param fileName The name of the file.
+        /// @param backend The mechanism to perform queued I/O with.
+        /// @param queueDepth The maximum number of requests to keep in the
+        /// kernel at once (and the number of workers for ThreadPool).
+        AsyncFileStream(std::string fileName, 
+            AsyncBackend backend = AsyncBackend::Auto, 
+            std::size_t queueDepth = 64);
+
+        ~AsyncFileStream();
+
+        /// @brief Opens the file and sets up the backend.
+        /// @param m The mode to open the file in.
+        /// @throw std::runtime_error if AsyncBackend::IoUring was requested
+        /// and io_uring is not available.
+        void Open(FileMode m = FileMode::Read) override;
+
+        /// @brief Waits for all queued requests, then closes the file.
+        ///
+        /// The completions of requests that were never reaped are 
+        /// discarded.
+        void Close() override;
+
+        /// @brief Gets the backend in use.
+        ///
+        /// Once the file has been opened, AsyncBackend::Auto has been 
+        /// resolved to the backend that was actually chosen.
+        ///
+        /// @return The backend in use.
+        AsyncBackend Backend() const
+        {
+            return mBackend;
+        }
+
+        /// @brief Queues a read of the field from the specified offset.
+        /// @param offset The offset to read from.
+        /// @param f The field to read into.
+        /// @return An identifier to match the request to its completion.
+        /// @pre The file must be opened in a mode that allows reading.
+        std::uint64_t EnqueueRead(std::size_t offset, Field* f);
+
+        /// @brief Queues a write of the field to the specified offset.
+        /// @param offset The offset to write to.
+        /// @param f The field to write.
+        /// @return An identifier to match the request to its completion.
+        /// @pre The file must be opened in a mode that allows writing.
+        std::uint64_t EnqueueWrite(std::size_t offset, Field* f);
+
+        /// @brief Hands every queued request to the backend.
+        /// @return The number of requests submitted.
+        std::size_t Submit();
+
+        /// @brief Collects the completions of finished requests.
+        ///
+        /// Any requests that have not been submitted yet are submitted 
+        /// first. Every completion that is already available is appended,
+        /// waiting until there are at least minCompletions or no requests
+        /// remain outstanding.
+        ///
+        /// @param completions The vector to append the completions to.
+        /// @param minCompletions The minimum number to wait for.
+        /// @return The number of completions appended.
+        std::size_t Reap(std::vector<AsyncCompletion>& completions,
+            std::size_t minCompletions = 1);
+
+        /// @brief Gets the number of requests that have not been reaped.
+        /// @return The number of queued and in flight requests.
+        std::size_t Pending() const
+        {
+            return mRequests.size();
+        }
+    private:
+        struct Request
+        {
+            Field* field;
+            std::size_t offset;
+            bool isWrite;
+        };
+
+        AsyncBackend mBackend;
+        std::size_t mQueueDepth;
+        std::unique_ptr<AsyncEngine> mEngine;
+        std::unordered_map<std::uint64_t, Request> mRequests;
+        std::vector<AsyncResult> mResults;
+        std::uint64_t mNextID;
+
+        std::uint64_t Enqueue(std::size_t offset, Field* f, bool isWrite);
+    };
+}
+
+#endif
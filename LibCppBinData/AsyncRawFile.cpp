@@ -0,0 +1,109 @@
+// AsyncRawFile.cpp - Defines the AsyncRawFile class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissionsand
+// limitations under the License.
+
+#include <cstring>
+#include <algorithm>
+#include "AsyncRawFile.h"
+
+#ifdef BIN_DATA_COROUTINES
+
+namespace BinData
+{
+    void AsyncRawFile::ReadAwaiter::await_suspend(
+        std::coroutine_handle<> handle)
+    {
+        AsyncFileStream* stream = mFile->mAsyncStream.get();
+        std::uint64_t id = stream->EnqueueRead(stream->Offset(), mField);
+        mFile->mLoop->Await(stream, id, &mCompletion, handle);
+    }
+
+    void AsyncRawFile::ReadAwaiter::await_resume()
+    {
+        if (!mCompletion.Succeeded())
+            throw InvalidFileOperation{ "Unable to read from file" };
+        mFile->mAsyncStream->SetOffset(mCompletion.offset + mField->Size());
+    }
+
+    AsyncRawFile::AsyncRawFile(std::shared_ptr<AsyncFileStream> stream, 
+        AsyncEventLoop& loop) 
+        : RawFile{ stream }, mAsyncStream{ stream }, mLoop{ &loop }
+    {
+
+    }
+
+    AsyncRawFile::ReadAwaiter AsyncRawFile::ReadAsync(Field* f)
+    {
+        // The same checks as Read() are made up front, so a bad read throws
+        // straight into the calling coroutine rather than being queued.
+        bool isReadable = Mode() == FileMode::Read || 
+            Mode() == FileMode::ReadWrite;
+        if (!IsOpen() || !isReadable)
+            throw InvalidFileOperation{ "File is not open for reading" };
+        if (Offset() + f->Size() > Size())
+            throw InvalidFileOperation{ "Cannot read beyond end of file" };
+
+        auto view = dynamic_cast<FieldView*>(f);
+        if (view != nullptr && !view->IsBound())
+            throw InvalidFileOperation{ "Cannot read into unbound view" };
+
+        return ReadAwaiter{ this, f };
+    }
+
+    Task<void> AsyncRawFile::ReadAsync(FieldStruct* s)
+    {
+        auto packed = dynamic_cast<PackedFieldStruct*>(s);
+        if (packed != nullptr)
+        {
+            if (packed->TotalSize() > 0)
+                co_await ReadAsync(packed->Buffer());
+            co_return;
+        }
+
+        for (std::shared_ptr<Field> f : s->Fields())
+            co_await ReadAsync(f.get());
+    }
+
+    Task<std::shared_ptr<ChunkHeader>> AsyncRawFile::FindChunkHeaderAsync(
+        std::string ID, Endianness endianness)
+    {
+        RawField header{ chunkHeaderSize };
+        std::size_t offset = Offset();
+
+        while (offset + chunkHeaderSize <= Size())
+        {
+            SetOffset(offset);
+            co_await ReadAsync(&header);
+
+            ChunkInfo chunk = ChunkInfo::Decode(header.Data(), offset, 
+                endianness);
+            if (chunk.ID() == ID)
+            {
+                auto found = std::make_shared<ChunkHeader>(endianness);
+                std::memcpy(found->ID()->Data(), chunk.id.data(), 
+                    chunk.id.size());
+                found->Size()->SetValue(chunk.size);
+                co_return found;
+            }
+
+            offset = chunk.EndOffset();
+        }
+
+        SetOffset(std::min(offset, Size()));
+        co_return nullptr;
+    }
+}
+
+#endif
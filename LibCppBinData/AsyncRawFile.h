@@ -0,0 +1,117 @@
+// AsyncRawFile.h - Declares the AsyncRawFile class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissionsand
+// limitations under the License.
+
+#ifndef BIN_DATA_ASYNC_RAW_FILE_H
+#define BIN_DATA_ASYNC_RAW_FILE_H
+
+#ifdef BIN_DATA_COROUTINES
+
+#include <cstddef>
+#include <string>
+#include <memory>
+#include <coroutine>
+#include "RawFile.h"
+#include "Task.h"
+#include "AsyncEventLoop.h"
+#include "AsyncFileStream.h"
+
+namespace BinData
+{
+    /// @brief A RawFile that can also be read from coroutines.
+    ///
+    /// Besides the usual synchronous interface, ReadAsync() and
+    /// FindChunkHeaderAsync() can be co_await-ed from a Task running on an
+    /// AsyncEventLoop. The awaiting coroutine is suspended while the read
+    /// is in flight on the AsyncFileStream, leaving the loop free to run
+    /// other tasks in the meantime.
+    ///
+    /// Asynchronous reads start at, and advance, the file's offset just as
+    /// Read() does, so one file must only be read by one task at a time.
+    class AsyncRawFile : public RawFile
+    {
+    public:
+        /// @brief The awaitable returned by ReadAsync().
+        class ReadAwaiter
+        {
+        public:
+            ReadAwaiter(AsyncRawFile* file, Field* f) 
+                : mFile{ file }, mField{ f }, mCompletion{} 
+            { 
+            
+            }
+
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            void await_suspend(std::coroutine_handle<> handle);
+
+            void await_resume();
+        private:
+            AsyncRawFile* mFile;
+            Field* mField;
+            AsyncCompletion mCompletion;
+        };
+
+        /// @brief Constructs a new AsyncRawFile.
+        /// @param stream The stream to read from.
+        /// @param loop The event loop the asynchronous reads are run on.
+        /// @invariant The loop must outlive the file.
+        AsyncRawFile(std::shared_ptr<AsyncFileStream> stream, 
+            AsyncEventLoop& loop);
+
+        /// @brief Reads data from the file into the field asynchronously.
+        ///
+        /// Reads at the current offset in an amount equal to the field size.
+        /// Views must already be bound to a buffer to read into.
+        ///
+        /// @param f The pointer to the binary data field to read into.
+        /// @return An awaitable that completes once the data has been read.
+        /// @pre The file must be opened for reading.
+        /// @pre There must be enough data remaining at the current offset.
+        /// @post The offset has advanced by field size once resumed.
+        ReadAwaiter ReadAsync(Field* f);
+
+        /// @brief Reads data into each field of the struct asynchronously.
+        /// @param s The pointer to the struct to read into.
+        /// @return A task that completes once the struct has been read.
+        /// @pre The file must be opened for reading.
+        Task<void> ReadAsync(FieldStruct* s);
+
+        /// @brief Finds the next chunk header with the specified ID.
+        ///
+        /// Walks the chain of chunks that begins at the current offset, 
+        /// reading one header at a time asynchronously and skipping over 
+        /// each payload.
+        ///
+        /// @param ID The ID of the chunk to find.
+        /// @param endianness The endianness of the chunk sizes.
+        /// @return A task producing the chunk header, or nullptr if no chunk
+        /// was found.
+        /// @post The offset is at the beginning of the chunk's payload, or
+        /// at the end of the chain if no chunk was found.
+        Task<std::shared_ptr<ChunkHeader>> FindChunkHeaderAsync(std::string ID,
+            Endianness endianness = Endianness::Little);
+    private:
+        std::shared_ptr<AsyncFileStream> mAsyncStream;
+        AsyncEventLoop* mLoop;
+    };
+}
+
+#endif
+
+#endif
@@ -17,14 +17,52 @@
 #ifndef LIB_CPP_BIN_DATA_H
 #define LIB_CPP_BIN_DATA_H
 
+#include "AlignedBuffer.h"
+#include "BlockCache.h"
 #include "Field.h"
+#include "FieldView.h"
 #include "FieldStruct.h"
+#include "PackedFieldStruct.h"
+#include "PackedChunkHeader.h"
 #include "ChunkHeader.h"
+#include "ChunkHeaderView.h"
+#include "ChunkInfo.h"
+#include "ChunkIndex.h"
+#include "ChunkIndexFile.h"
+#include "ChunkRange.h"
+#include "ChunkTree.h"
+#include "ParallelChunkScanner.h"
 #include "File.h"
+#include "FileCursor.h"
 #include "Format.h"
 #include "IntField.h"
+#include "IntFieldView.h"
+#include "IntFieldBase.h"
+#include "InlineIntField.h"
+#include "FixedIntField.h"
+#include "IntArrayConversion.h"
+#include "IntArrayField.h"
+#include "MemoryStream.h"
 #include "RawField.h"
+#include "RawFieldView.h"
+#include "ReadRequest.h"
+#include "SpscQueue.h"
 #include "StdFileStream.h"
 #include "StringField.h"
+#include "StringFieldView.h"
+
+#ifdef BIN_DATA_POSIX
+#include "MmapFileStream.h"
+#include "PosixFileStream.h"
+#include "PrefetchFileStream.h"
+#include "DirectFileStream.h"
+#include "AsyncFileStream.h"
+#endif
+
+#ifdef BIN_DATA_COROUTINES
+#include "Task.h"
+#include "AsyncEventLoop.h"
+#include "AsyncRawFile.h"
+#endif
 
 #endif
\ No newline at end of file
@@ -0,0 +1,96 @@
+// BlockCache.cpp - Defines the BlockCache class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <iterator>
+#include "BlockCache.h"
+
+namespace BinData
+{
+    const std::vector<char>* BlockCache::Find(std::size_t index)
+    {
+        // Consecutive small reads usually land in the same block, which is
+        // already at the front, so skip the lookup for it.
+        if (!mBlocks.empty() && mBlocks.front().index == index)
+        {
+            mHits++;
+            return &mBlocks.front().data;
+        }
+
+        auto found = mLookup.find(index);
+        if (found == mLookup.end())
+        {
+            mMisses++;
+            return nullptr;
+        }
+
+        mHits++;
+        mBlocks.splice(mBlocks.begin(), mBlocks, found->second);
+        return &mBlocks.front().data;
+    }
+
+    std::vector<char>& BlockCache::Insert(std::size_t index, std::size_t size)
+    {
+        auto found = mLookup.find(index);
+        if (found != mLookup.end())
+        {
+            mBlocks.splice(mBlocks.begin(), mBlocks, found->second);
+        }
+        else if (mBlocks.size() < mBlockCount)
+        {
+            mBlocks.push_front(Block{ index, {} });
+            mLookup[index] = mBlocks.begin();
+        }
+        else
+        {
+            // Recycle the least recently used block so that its buffer is
+            // reused rather than freed and allocated again.
+            mLookup.erase(mBlocks.back().index);
+            mBlocks.splice(mBlocks.begin(), mBlocks, std::prev(mBlocks.end()));
+            mBlocks.front().index = index;
+            mLookup[index] = mBlocks.begin();
+        }
+
+        mBlocks.front().data.resize(size);
+        return mBlocks.front().data;
+    }
+
+    void BlockCache::Invalidate(std::size_t offset, std::size_t size)
+    {
+        if (size == 0 || !IsEnabled())
+            return;
+
+        std::size_t first = offset / mBlockSize;
+        std::size_t last = (offset + size - 1) / mBlockSize;
+        for (auto block = mBlocks.begin(); block != mBlocks.end();)
+        {
+            if (block->index >= first && block->index <= last)
+            {
+                mLookup.erase(block->index);
+                block = mBlocks.erase(block);
+            }
+            else
+            {
+                block++;
+            }
+        }
+    }
+
+    void BlockCache::Clear()
+    {
+        mBlocks.clear();
+        mLookup.clear();
+    }
+}
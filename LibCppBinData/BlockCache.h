@@ -0,0 +1,133 @@
+// BlockCache.h - Declares the BlockCache class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIN_DATA_BLOCK_CACHE_H
+#define BIN_DATA_BLOCK_CACHE_H
+
+#include <cstddef>
+#include <vector>
+#include <list>
+#include <unordered_map>
+
+namespace BinData
+{
+    /// @brief The default size of a cached block, in bytes.
+    constexpr std::size_t defaultCacheBlockSize{ 64 * 1024 };
+
+    /// @brief The default number of blocks a BlockCache holds.
+    constexpr std::size_t defaultCacheBlockCount{ 16 };
+
+    /// @brief A least recently used cache of fixed size file blocks.
+    ///
+    /// Block n holds the file data starting at offset n * BlockSize(). Only
+    /// the last block of a file may hold fewer than BlockSize() bytes. The
+    /// cache only stores blocks; the stream that owns it is responsible for
+    /// filling them and for invalidating them when the file is written.
+    class BlockCache
+    {
+    public:
+        /// @brief Constructs an empty BlockCache.
+        /// @param blockSize The size of each block, in bytes.
+        /// @param blockCount The most blocks to hold at once, or zero to
+        /// disable the cache.
+        BlockCache(std::size_t blockSize = defaultCacheBlockSize,
+            std::size_t blockCount = defaultCacheBlockCount)
+            : mBlockSize{ blockSize }, mBlockCount{ blockCount }, mHits{ 0 },
+            mMisses{ 0 }
+        { }
+
+        /// @brief Gets the size of each block, in bytes.
+        std::size_t BlockSize() const
+        {
+            return mBlockSize;
+        }
+
+        /// @brief Gets the most blocks the cache holds at once.
+        std::size_t BlockCount() const
+        {
+            return mBlockCount;
+        }
+
+        /// @brief Determines if the cache can hold any blocks.
+        bool IsEnabled() const
+        {
+            return mBlockSize > 0 && mBlockCount > 0;
+        }
+
+        /// @brief Gets the number of blocks currently cached.
+        std::size_t CachedBlocks() const
+        {
+            return mBlocks.size();
+        }
+
+        /// @brief Gets the number of times Find() located its block.
+        std::size_t Hits() const
+        {
+            return mHits;
+        }
+
+        /// @brief Gets the number of times Find() did not locate its block.
+        std::size_t Misses() const
+        {
+            return mMisses;
+        }
+
+        /// @brief Determines if a block is cached, without counting a hit or
+        /// miss or changing its position in the LRU order.
+        /// @param index The index of the block.
+        bool Contains(std::size_t index) const
+        {
+            return mLookup.find(index) != mLookup.end();
+        }
+
+        /// @brief Finds a block and marks it as the most recently used.
+        /// @param index The index of the block.
+        /// @return A pointer to the block's data, or nullptr if the block
+        /// is not cached.
+        const std::vector<char>* Find(std::size_t index);
+
+        /// @brief Adds a block as the most recently used, evicting the least
+        /// recently used block if the cache is full.
+        /// @param index The index of the block.
+        /// @param size The number of bytes the block holds.
+        /// @return The block's buffer, which the caller must fill.
+        /// @pre The cache must be enabled.
+        std::vector<char>& Insert(std::size_t index, std::size_t size);
+
+        /// @brief Evicts every block that overlaps a range of the file.
+        /// @param offset The offset of the range.
+        /// @param size The size of the range, in bytes.
+        void Invalidate(std::size_t offset, std::size_t size);
+
+        /// @brief Evicts every block, keeping the hit and miss counts.
+        void Clear();
+    private:
+        struct Block
+        {
+            std::size_t index;
+            std::vector<char> data;
+        };
+
+        std::size_t mBlockSize;
+        std::size_t mBlockCount;
+        std::size_t mHits;
+        std::size_t mMisses;
+        std::list<Block> mBlocks;
+        std::unordered_map<std::size_t, std::list<Block>::iterator> mLookup;
+    };
+}
+
+#endif
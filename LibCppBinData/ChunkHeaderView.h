@@ -0,0 +1,64 @@
+// ChunkHeaderView.h - Declares the ChunkHeaderView class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIN_DATA_CHUNK_HEADER_VIEW_H
+#define BIN_DATA_CHUNK_HEADER_VIEW_H
+
+#include <vector>
+#include <memory>
+#include "Field.h"
+#include "StringFieldView.h"
+#include "IntFieldView.h"
+#include "FieldStruct.h"
+#include "Endianness.h"
+
+namespace BinData
+{
+    /// @brief A non-owning equivalent of ChunkHeader.
+    ///
+    /// Reading a ChunkHeaderView from a stream that supports views binds
+    /// the ID and Size fields directly to the header bytes in place.
+    class ChunkHeaderView : public FieldStruct
+    {
+    public:
+        ChunkHeaderView(Endianness endianness = Endianness::Little) :
+            fields
+            {
+                std::make_shared<StringFieldView>(4),
+                std::make_shared<UInt32FieldView>(endianness)
+            }
+        { }
+
+        std::shared_ptr<StringFieldView> ID() 
+        {
+            return std::static_pointer_cast<StringFieldView>(fields.at(0));
+        }
+
+        std::shared_ptr<UInt32FieldView> Size()
+        {
+            return std::static_pointer_cast<UInt32FieldView>(fields.at(1));
+        }
+
+        std::vector<std::shared_ptr<Field>> Fields() const override 
+        {
+            return fields; 
+        }
+    private:
+        std::vector<std::shared_ptr<Field>> fields;
+    };
+}
+
+#endif
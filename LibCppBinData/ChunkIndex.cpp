@@ -0,0 +1,69 @@
+// ChunkIndex.cpp - Defines the ChunkIndex class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include "ChunkIndex.h"
+
+namespace BinData
+{
+    void ChunkIndex::Add(const ChunkInfo& c)
+    {
+        mIDs[c.ID()].push_back(mChunks.size());
+        mChunks.push_back(c);
+        mEnd = c.EndOffset();
+    }
+
+    bool ChunkIndex::IsBoundary(std::size_t offset) const
+    {
+        if (offset == mEnd)
+            return true;
+        auto chunk = std::lower_bound(mChunks.begin(), mChunks.end(), offset,
+            [](const ChunkInfo& c, std::size_t o) { return c.offset < o; });
+        return chunk != mChunks.end() && chunk->offset == offset;
+    }
+
+    const ChunkInfo* ChunkIndex::Find(const std::string& ID, 
+        std::size_t from) const
+    {
+        auto entry = mIDs.find(ID);
+        if (entry == mIDs.end())
+            return nullptr;
+
+        // The positions are stored in file order, so the first chunk at or
+        // after the offset can be found with a binary search.
+        const std::vector<std::size_t>& positions = entry->second;
+        auto position = std::lower_bound(positions.begin(), positions.end(),
+            from, [this](std::size_t p, std::size_t o) 
+            { 
+                return mChunks[p].offset < o; 
+            });
+        if (position == positions.end())
+            return nullptr;
+        return &mChunks[*position];
+    }
+
+    std::vector<ChunkInfo> ChunkIndex::FindAll(const std::string& ID) const
+    {
+        std::vector<ChunkInfo> chunks;
+        auto entry = mIDs.find(ID);
+        if (entry != mIDs.end())
+        {
+            for (std::size_t position : entry->second)
+                chunks.push_back(mChunks[position]);
+        }
+        return chunks;
+    }
+}
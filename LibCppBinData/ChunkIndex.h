@@ -0,0 +1,101 @@
+// ChunkIndex.h - Declares the ChunkIndex class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIN_DATA_CHUNK_INDEX_H
+#define BIN_DATA_CHUNK_INDEX_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "ChunkInfo.h"
+#include "Endianness.h"
+
+namespace BinData
+{
+    /// @brief An index of a sequence of consecutive chunks in a file.
+    ///
+    /// The index records every chunk in the chain that begins at Start(),
+    /// in file order, along with a lookup table from chunk ID to the chunks
+    /// that have that ID. Once built, locating a chunk no longer requires
+    /// reading any headers from the file.
+    class ChunkIndex
+    {
+    public:
+        /// @brief Constructs an empty ChunkIndex.
+        /// @param start The offset of the first chunk header in the chain.
+        /// @param endianness The endianness the chunk sizes were read in.
+        ChunkIndex(std::size_t start, Endianness endianness)
+            : mStart{ start }, mEnd{ start }, mEndianness{ endianness }
+        { }
+
+        /// @brief Gets the offset of the first chunk header in the chain.
+        std::size_t Start() const
+        {
+            return mStart;
+        }
+
+        /// @brief Gets the offset immediately following the last chunk.
+        std::size_t End() const
+        {
+            return mEnd;
+        }
+
+        /// @brief Gets the endianness the chunk sizes were read in.
+        Endianness Endian() const
+        {
+            return mEndianness;
+        }
+
+        /// @brief Gets every indexed chunk, in file order.
+        const std::vector<ChunkInfo>& Chunks() const
+        {
+            return mChunks;
+        }
+
+        /// @brief Appends a chunk to the end of the index.
+        /// @param c The chunk to add.
+        /// @pre The chunk must begin where the previous chunk ended.
+        void Add(const ChunkInfo& c);
+
+        /// @brief Determines if an offset is a chunk boundary in the chain.
+        /// @param offset The offset to check.
+        /// @return True if a chunk header begins at the offset, or the offset
+        /// is the end of the chain, otherwise false.
+        bool IsBoundary(std::size_t offset) const;
+
+        /// @brief Finds the first chunk with the specified ID.
+        /// @param ID The ID of the chunk to find.
+        /// @param from The offset to begin searching from.
+        /// @return A pointer to the first matching chunk with a header at or
+        /// after the offset, or nullptr if there is none.
+        const ChunkInfo* Find(const std::string& ID, 
+            std::size_t from = 0) const;
+
+        /// @brief Finds every chunk with the specified ID.
+        /// @param ID The ID of the chunks to find.
+        /// @return The matching chunks, in file order.
+        std::vector<ChunkInfo> FindAll(const std::string& ID) const;
+    private:
+        std::size_t mStart;
+        std::size_t mEnd;
+        Endianness mEndianness;
+        std::vector<ChunkInfo> mChunks;
+        std::unordered_map<std::string, std::vector<std::size_t>> mIDs;
+    };
+}
+
+#endif
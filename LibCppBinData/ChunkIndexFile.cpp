@@ -0,0 +1,200 @@
+// ChunkIndexFile.cpp - Defines the ChunkIndexFile class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <filesystem>
+#include <random>
+#include <vector>
+#include "ChunkIndexFile.h"
+#include "RawFile.h"
+#include "RawField.h"
+#include "RawFieldView.h"
+#include "StringFieldView.h"
+#include "IntFieldView.h"
+#include "PackedFieldStruct.h"
+
+namespace
+{
+    using namespace BinData;
+
+    constexpr const char* indexFileMagic{ "BDCI" };
+    constexpr unsigned long indexFileVersion{ 1 };
+
+    // The sidecar begins with a fixed size header, which is followed by
+    // one fixed size entry per chunk. All values are little endian.
+    class IndexFileHeader : public PackedFieldStruct
+    {
+    public:
+        IndexFileHeader()
+        {
+            magic = AddField<StringFieldView>(4);
+            version = AddField<UInt32FieldView>();
+            fileSize = AddField<UInt64FieldView>();
+            modified = AddField<Int64FieldView>();
+            start = AddField<UInt64FieldView>();
+            endianness = AddField<UInt8FieldView>();
+            count = AddField<UInt64FieldView>();
+        }
+
+        std::shared_ptr<StringFieldView> magic;
+        std::shared_ptr<UInt32FieldView> version;
+        std::shared_ptr<UInt64FieldView> fileSize;
+        std::shared_ptr<Int64FieldView> modified;
+        std::shared_ptr<UInt64FieldView> start;
+        std::shared_ptr<UInt8FieldView> endianness;
+        std::shared_ptr<UInt64FieldView> count;
+    };
+
+    // Entries are transferred as a single block and decoded in place by
+    // binding an entry's views to each record in turn.
+    class IndexFileEntry : public FieldStruct
+    {
+    public:
+        IndexFileEntry() :
+            id{ std::make_shared<RawFieldView>(chunkIDSize) },
+            offset{ std::make_shared<UInt64FieldView>() },
+            size{ std::make_shared<UInt64FieldView>() }
+        { }
+
+        std::vector<std::shared_ptr<Field>> Fields() const override
+        {
+            return { id, offset, size };
+        }
+
+        std::shared_ptr<RawFieldView> id;
+        std::shared_ptr<UInt64FieldView> offset;
+        std::shared_ptr<UInt64FieldView> size;
+    };
+
+    constexpr std::size_t indexFileEntrySize{ chunkIDSize + 8 + 8 };
+}
+
+namespace BinData
+{
+    ChunkIndexKey ChunkIndexKey::FromFile(const std::string& fileName)
+    {
+        ChunkIndexKey key;
+        key.fileSize = std::filesystem::file_size(fileName);
+        auto modified = std::filesystem::last_write_time(fileName);
+        key.modified = modified.time_since_epoch().count();
+        return key;
+    }
+
+    void ChunkIndexFile::Save(const ChunkIndex& index, 
+        const ChunkIndexKey& key) const
+    {
+        const std::vector<ChunkInfo>& chunks = index.Chunks();
+
+        IndexFileHeader header;
+        header.magic->SetData(indexFileMagic);
+        header.version->SetValue(indexFileVersion);
+        header.fileSize->SetValue(key.fileSize);
+        header.modified->SetValue(key.modified);
+        header.start->SetValue(index.Start());
+        header.endianness->SetValue(
+            index.Endian() == Endianness::Big ? 1 : 0);
+        header.count->SetValue(chunks.size());
+
+        // Other processes may be loading the sidecar while it is saved, so
+        // the new contents are written to a uniquely named file in the same
+        // directory and then renamed over the sidecar, which they either
+        // see in full or not at all.
+        std::string tempName = mFileName + ".tmp" + 
+            std::to_string(std::random_device{}());
+        try
+        {
+            RawFile file{ tempName };
+            file.Open(FileMode::Write);
+            file.Write(&header);
+
+            if (!chunks.empty())
+            {
+                RawField block{ chunks.size() * indexFileEntrySize };
+                IndexFileEntry entry;
+                for (std::size_t i = 0; i < chunks.size(); i++)
+                {
+                    entry.Bind(block.Data() + i * indexFileEntrySize);
+                    std::memcpy(entry.id->Data(), chunks[i].id.data(), 
+                        chunkIDSize);
+                    entry.offset->SetValue(chunks[i].offset);
+                    entry.size->SetValue(chunks[i].size);
+                }
+                file.Write(&block);
+            }
+
+            file.Close();
+            std::filesystem::rename(tempName, mFileName);
+        }
+        catch (...)
+        {
+            std::error_code error;
+            std::filesystem::remove(tempName, error);
+            throw;
+        }
+    }
+
+    std::shared_ptr<ChunkIndex> ChunkIndexFile::Load(
+        const ChunkIndexKey& key) const
+    {
+        RawFile file{ mFileName };
+        IndexFileHeader header;
+        if (!file.Exists() || file.Size() < header.TotalSize())
+            return nullptr;
+
+        file.Open(FileMode::Read);
+        file.Read(&header);
+
+        bool isValid = header.magic->ToString() == indexFileMagic &&
+            header.version->Value() == indexFileVersion;
+        bool isCurrent = header.fileSize->Value() == key.fileSize &&
+            header.modified->Value() == key.modified;
+        if (!isValid || !isCurrent)
+            return nullptr;
+
+        // The count comes from the sidecar itself, so it is checked against
+        // the space available for entries before it is used in any size
+        // calculation that could wrap around.
+        std::size_t entriesSize = file.Size() - header.TotalSize();
+        if (header.count->Value() > entriesSize / indexFileEntrySize)
+            return nullptr;
+        std::size_t count = header.count->Value();
+        if (entriesSize != count * indexFileEntrySize)
+            return nullptr;
+
+        Endianness endianness = header.endianness->Value() == 1 ?
+            Endianness::Big : Endianness::Little;
+        auto index = std::make_shared<ChunkIndex>(header.start->Value(), 
+            endianness);
+
+        if (count > 0)
+        {
+            RawField block{ count * indexFileEntrySize };
+            file.Read(&block);
+            IndexFileEntry entry;
+            for (std::size_t i = 0; i < count; i++)
+            {
+                entry.Bind(block.Data() + i * indexFileEntrySize);
+                ChunkInfo chunk;
+                std::memcpy(chunk.id.data(), entry.id->Data(), chunkIDSize);
+                chunk.offset = entry.offset->Value();
+                chunk.size = entry.size->Value();
+                index->Add(chunk);
+            }
+        }
+
+        return index;
+    }
+}
@@ -0,0 +1,87 @@
+// ChunkIndexFile.h - Declares the ChunkIndexFile class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIN_DATA_CHUNK_INDEX_FILE_H
+#define BIN_DATA_CHUNK_INDEX_FILE_H
+
+#include <cstdint>
+#include <string>
+#include <memory>
+#include "ChunkIndex.h"
+
+namespace BinData
+{
+    /// @brief Identifies the exact version of a file a ChunkIndex describes.
+    struct ChunkIndexKey
+    {
+        /// @brief The size of the indexed file, in bytes.
+        std::uint64_t fileSize;
+
+        /// @brief The last write time of the indexed file.
+        std::int64_t modified;
+
+        /// @brief Gets the key of a file as it currently exists on disk.
+        /// @param fileName The name of the indexed file.
+        /// @return The file's key.
+        static ChunkIndexKey FromFile(const std::string& fileName);
+
+        bool operator==(const ChunkIndexKey& k) const
+        {
+            return fileSize == k.fileSize && modified == k.modified;
+        }
+    };
+
+    /// @brief Persists a ChunkIndex to a small binary sidecar file.
+    ///
+    /// The sidecar records the size and last write time of the file it
+    /// indexes, so a stale sidecar is detected and ignored once the indexed
+    /// file changes.
+    class ChunkIndexFile
+    {
+    public:
+        /// @brief Constructs a ChunkIndexFile for the specified sidecar.
+        /// @param fileName The name of the sidecar file.
+        ChunkIndexFile(std::string fileName) : mFileName{ fileName } { }
+
+        /// @brief Gets the conventional sidecar name for an indexed file.
+        /// @param fileName The name of the indexed file.
+        /// @return The name of the sidecar file.
+        static std::string SidecarName(const std::string& fileName)
+        {
+            return fileName + ".chunkidx";
+        }
+
+        std::string FileName() const
+        {
+            return mFileName;
+        }
+
+        /// @brief Writes the index to the sidecar, replacing its contents.
+        /// @param index The index to write.
+        /// @param key The key of the file the index describes.
+        void Save(const ChunkIndex& index, const ChunkIndexKey& key) const;
+
+        /// @brief Reads the index from the sidecar.
+        /// @param key The key of the file the index is expected to describe.
+        /// @return The index, or nullptr if the sidecar does not exist, is
+        /// invalid, or was written for a different version of the file.
+        std::shared_ptr<ChunkIndex> Load(const ChunkIndexKey& key) const;
+    private:
+        std::string mFileName;
+    };
+}
+
+#endif
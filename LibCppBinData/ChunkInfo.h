@@ -0,0 +1,94 @@
+// ChunkInfo.h - Declares the ChunkInfo struct.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIN_DATA_CHUNK_INFO_H
+#define BIN_DATA_CHUNK_INFO_H
+
+#include <cstddef>
+#include <array>
+#include <cstring>
+#include <string>
+#include "Format.h"
+#include "Endianness.h"
+#include "IntConversion.h"
+
+namespace BinData
+{
+    /// @brief The size of a chunk header (a FourCC ID and a 32-bit size).
+    constexpr std::size_t chunkHeaderSize{ 8 };
+
+    /// @brief The size of a chunk ID (FourCC), in bytes.
+    constexpr std::size_t chunkIDSize{ 4 };
+
+    /// @brief A lightweight description of a chunk's location in a file.
+    ///
+    /// Unlike ChunkHeader, a ChunkInfo holds no fields and performs no heap
+    /// allocations, so large numbers of them are cheap to store and copy.
+    struct ChunkInfo
+    {
+        /// @brief The raw bytes of the chunk's FourCC ID.
+        std::array<char, chunkIDSize> id;
+
+        /// @brief The offset of the chunk's header within the file.
+        std::size_t offset;
+
+        /// @brief The size of the chunk's payload, as stored in its header.
+        std::size_t size;
+
+        /// @brief Decodes a chunk header that has been read into memory.
+        /// @param header A pointer to chunkHeaderSize bytes of header data.
+        /// @param offset The offset the header was read from.
+        /// @param endianness The endianness of the chunk size.
+        /// @return The ChunkInfo describing the chunk.
+        static ChunkInfo Decode(const char* header, std::size_t offset,
+            Endianness endianness)
+        {
+            ChunkInfo chunk;
+            std::memcpy(chunk.id.data(), header, chunkIDSize);
+            chunk.offset = offset;
+            chunk.size = DecodeInt<unsigned long, 4>(header + chunkIDSize,
+                endianness);
+            return chunk;
+        }
+
+        /// @brief Gets the chunk ID as a string.
+        ///
+        /// The ID is formatted the same way as ChunkHeader::ID()->ToString()
+        /// so the two can be compared directly.
+        ///
+        /// @return The ASCII string representation of the chunk ID.
+        std::string ID() const
+        {
+            return FormatAscii(const_cast<char*>(id.data()), id.size());
+        }
+
+        /// @brief Gets the offset of the chunk's payload within the file.
+        /// @return The offset of the first byte following the header.
+        std::size_t PayloadOffset() const
+        {
+            return offset + chunkHeaderSize;
+        }
+
+        /// @brief Gets the offset of the byte following the chunk's payload.
+        /// @return The offset where the next chunk header would begin.
+        std::size_t EndOffset() const
+        {
+            return PayloadOffset() + size;
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,67 @@
+// ChunkRange.cpp - Defines the ChunkRange class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissionsand
+// limitations under the License.
+
+#include <algorithm>
+#include "ChunkRange.h"
+#include "File.h"
+
+namespace BinData
+{
+    ChunkRange::ChunkRange(File* file, Endianness endianness)
+        : mFile{ file }, mEndianness{ endianness }, mBuffer{}, 
+        mHeader{ mBuffer.data(), mBuffer.size() }, mChunk{}, 
+        mNextOffset{ 0 }, mIsStarted{ false }, mIsDone{ false }
+    {
+        if (mFile == nullptr)
+            throw InvalidFile{ "file cannot be null" };
+    }
+
+    ChunkRange::Iterator ChunkRange::begin()
+    {
+        if (!mIsStarted)
+        {
+            mIsStarted = true;
+            mNextOffset = mFile->Offset();
+            Next();
+        }
+        return Iterator{ this };
+    }
+
+    void ChunkRange::Next()
+    {
+        if (mIsDone)
+            return;
+
+        // Stop once there is no longer room for another header, leaving the
+        // offset at the end of the chain (or of the file if it is truncated).
+        std::size_t size = mFile->Size();
+        if (mNextOffset + chunkHeaderSize > size)
+        {
+            mFile->SetOffset(std::min(mNextOffset, size));
+            mIsDone = true;
+            return;
+        }
+
+        // The header may have been rebound to the stream's own data by the
+        // previous read, so point it back at our buffer first.
+        mHeader.Bind(mBuffer.data());
+        mFile->SetOffset(mNextOffset);
+        mFile->Read(&mHeader);
+
+        mChunk = ChunkInfo::Decode(mHeader.Data(), mNextOffset, mEndianness);
+        mNextOffset = mChunk.EndOffset();
+    }
+}
@@ -0,0 +1,140 @@
+// ChunkRange.h - Declares the ChunkRange class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissionsand
+// limitations under the License.
+
+#ifndef BIN_DATA_CHUNK_RANGE_H
+#define BIN_DATA_CHUNK_RANGE_H
+
+#include <cstddef>
+#include <array>
+#include <iterator>
+#include "Endianness.h"
+#include "ChunkInfo.h"
+#include "RawFieldView.h"
+
+namespace BinData
+{
+    class File;
+
+    /// @brief A lazily evaluated range over the chunks in a file.
+    ///
+    /// The range walks the chain of chunks that begins at the file's offset
+    /// when the range is created, reading one header at a time as it is
+    /// iterated. Headers are read into a buffer owned by the range, so
+    /// enumerating chunks performs no heap allocations, and moving to the
+    /// next chunk skips the current payload with a single seek.
+    ///
+    /// While a chunk is being visited, the file's offset is at the start of
+    /// its payload, so the payload may be read before moving on. Breaking
+    /// out of the loop early leaves the offset there. Once the range is
+    /// exhausted, the offset is at the end of the chain.
+    ///
+    /// This is a single-pass input range; it can only be iterated once.
+    class ChunkRange
+    {
+    public:
+        /// @brief An input iterator over the chunks in a ChunkRange.
+        class Iterator
+        {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = ChunkInfo;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const ChunkInfo*;
+            using reference = const ChunkInfo&;
+
+            /// @brief Constructs an iterator past the end of any range.
+            Iterator() : mRange{ nullptr } { }
+
+            /// @brief Constructs an iterator at the range's current chunk.
+            /// @param range The range to iterate over.
+            Iterator(ChunkRange* range) : mRange{ range } { }
+
+            reference operator*() const
+            {
+                return mRange->mChunk;
+            }
+
+            pointer operator->() const
+            {
+                return &mRange->mChunk;
+            }
+
+            Iterator& operator++()
+            {
+                mRange->Next();
+                return *this;
+            }
+
+            void operator++(int)
+            {
+                mRange->Next();
+            }
+
+            bool operator==(const Iterator& other) const
+            {
+                return IsEnd() == other.IsEnd();
+            }
+
+            bool operator!=(const Iterator& other) const
+            {
+                return !(*this == other);
+            }
+        private:
+            ChunkRange* mRange;
+
+            bool IsEnd() const
+            {
+                return mRange == nullptr || mRange->mIsDone;
+            }
+        };
+
+        /// @brief Constructs a range over the chunks in the specified file.
+        /// @param file The file to enumerate the chunks of.
+        /// @param endianness The endianness of the chunk sizes.
+        /// @pre The file must be opened for reading.
+        /// @invariant The file must outlive the range.
+        ChunkRange(File* file, 
+            Endianness endianness = Endianness::Little);
+
+        ChunkRange(const ChunkRange&) = delete;
+
+        ChunkRange& operator=(const ChunkRange&) = delete;
+
+        /// @brief Reads the first chunk header and returns an iterator to it.
+        /// @return An iterator to the first chunk, or end() if there is none.
+        Iterator begin();
+
+        /// @brief Gets the iterator that marks the end of the range.
+        /// @return The iterator that marks the end of the range.
+        Iterator end()
+        {
+            return Iterator{};
+        }
+    private:
+        File* mFile;
+        Endianness mEndianness;
+        std::array<char, chunkHeaderSize> mBuffer;
+        RawFieldView mHeader;
+        ChunkInfo mChunk;
+        std::size_t mNextOffset;
+        bool mIsStarted;
+        bool mIsDone;
+
+        void Next();
+    };
+}
+
+#endif
@@ -0,0 +1,176 @@
+// ChunkTree.cpp - Defines the ChunkNode struct and ChunkTreeWalker class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissionsand
+// limitations under the License.
+
+#include <cstring>
+#include <algorithm>
+#include "ChunkTree.h"
+#include "File.h"
+
+namespace BinData
+{
+    std::string ChunkNode::FormType() const
+    {
+        if (!isContainer)
+            return "";
+        return FormatAscii(const_cast<char*>(formType.data()), 
+            formType.size());
+    }
+
+    const ChunkNode* ChunkNode::Find(std::string ID) const
+    {
+        if (info.ID() == ID)
+            return this;
+
+        for (const ChunkNode& child : children)
+        {
+            const ChunkNode* found = child.Find(ID);
+            if (found != nullptr)
+                return found;
+        }
+
+        return nullptr;
+    }
+
+    ChunkTreeWalker::ChunkTreeWalker(File* file, Endianness endianness)
+        : mFile{ file }, mEndianness{ endianness }, mIsPadded{ true },
+        mHeaderBuffer{}, mFormTypeBuffer{}, 
+        mHeader{ mHeaderBuffer.data(), mHeaderBuffer.size() },
+        mFormType{ mFormTypeBuffer.data(), mFormTypeBuffer.size() }
+    {
+        if (mFile == nullptr)
+            throw InvalidFile{ "file cannot be null" };
+
+        AddContainerID("RIFF");
+        AddContainerID("RIFX");
+        AddContainerID("LIST");
+    }
+
+    void ChunkTreeWalker::AddContainerID(std::string ID)
+    {
+        if (ID.size() != chunkIDSize)
+            throw InvalidFileOperation{ "Container IDs must be 4 characters" };
+
+        std::array<char, chunkIDSize> id;
+        std::memcpy(id.data(), ID.data(), id.size());
+        mContainerIDs.push_back(id);
+    }
+
+    bool ChunkTreeWalker::IsContainerID(
+        const std::array<char, chunkIDSize>& id) const
+    {
+        return std::find(mContainerIDs.begin(), mContainerIDs.end(), id) !=
+            mContainerIDs.end();
+    }
+
+    void ChunkTreeWalker::Walk(std::function<void(const ChunkNode&)> visitor)
+    {
+        // Each open container is tracked by the end of its payload, which
+        // bounds its children, and by the offset of its next sibling. This
+        // stack is the only state that grows during the walk.
+        struct Container
+        {
+            std::size_t end;
+            std::size_t next;
+        };
+        std::vector<Container> containers;
+
+        std::size_t fileSize = mFile->Size();
+        std::size_t offset = mFile->Offset();
+        ChunkNode node;
+
+        while (true)
+        {
+            std::size_t limit = containers.empty() ? 
+                fileSize : containers.back().end;
+
+            // Leave the innermost container once there is no room left in
+            // it for another header, resuming at the container's sibling.
+            if (offset + chunkHeaderSize > limit)
+            {
+                if (containers.empty())
+                    break;
+                offset = containers.back().next;
+                containers.pop_back();
+                continue;
+            }
+
+            // Views may have been rebound to the stream's own data by a
+            // previous read, so point them back at our buffers first.
+            mHeader.Bind(mHeaderBuffer.data());
+            mFile->SetOffset(offset);
+            mFile->Read(&mHeader);
+
+            node.info = ChunkInfo::Decode(mHeader.Data(), offset, mEndianness);
+            node.depth = containers.size();
+            node.isContainer = IsContainerID(node.info.id) &&
+                node.info.size >= chunkIDSize &&
+                node.info.PayloadOffset() + chunkIDSize <= limit;
+            node.formType.fill('\0');
+
+            if (node.isContainer)
+            {
+                // The form type immediately follows the header, so reading
+                // it continues the same forward pass.
+                mFormType.Bind(mFormTypeBuffer.data());
+                mFile->Read(&mFormType);
+                std::memcpy(node.formType.data(), mFormType.Data(), 
+                    node.formType.size());
+
+                visitor(node);
+                Container container;
+                container.end = std::min(node.info.EndOffset(), limit);
+                container.next = NextOffset(node.info);
+                containers.push_back(container);
+                offset = node.info.PayloadOffset() + chunkIDSize;
+            }
+            else
+            {
+                visitor(node);
+                offset = NextOffset(node.info);
+            }
+        }
+
+        mFile->SetOffset(std::min(offset, fileSize));
+    }
+
+    std::vector<ChunkNode> ChunkTreeWalker::BuildTree()
+    {
+        std::vector<ChunkNode> tree;
+
+        // levels[d] is the list that nodes at depth d are appended to. Only
+        // the last node at each depth can gain children, so the pointers to
+        // deeper levels are dropped before a new sibling is appended.
+        std::vector<std::vector<ChunkNode>*> levels{ &tree };
+
+        Walk([&levels](const ChunkNode& node)
+        {
+            levels.resize(node.depth + 1);
+            levels[node.depth]->push_back(node);
+            if (node.isContainer)
+                levels.push_back(&levels[node.depth]->back().children);
+        });
+
+        return tree;
+    }
+
+    std::size_t ChunkTreeWalker::NextOffset(const ChunkInfo& chunk) const
+    {
+        std::size_t next = chunk.EndOffset();
+        if (mIsPadded && chunk.size % 2 != 0)
+            next++;
+        return next;
+    }
+}
@@ -0,0 +1,137 @@
+// ChunkTree.h - Declares the ChunkNode struct and ChunkTreeWalker class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissionsand
+// limitations under the License.
+
+#ifndef BIN_DATA_CHUNK_TREE_H
+#define BIN_DATA_CHUNK_TREE_H
+
+#include <cstddef>
+#include <array>
+#include <string>
+#include <vector>
+#include <functional>
+#include "Endianness.h"
+#include "ChunkInfo.h"
+#include "RawFieldView.h"
+
+namespace BinData
+{
+    class File;
+
+    /// @brief A chunk within a tree of nested chunks.
+    struct ChunkNode
+    {
+        /// @brief The location of the chunk within the file.
+        ChunkInfo info;
+
+        /// @brief The raw bytes of the container's form type (e.g. "WAVE").
+        ///
+        /// Only meaningful when isContainer is true.
+        std::array<char, chunkIDSize> formType;
+
+        /// @brief True if the chunk's payload is made up of child chunks.
+        bool isContainer;
+
+        /// @brief The number of containers the chunk is nested inside of.
+        std::size_t depth;
+
+        /// @brief The chunks nested inside this one, in file order.
+        ///
+        /// This is only populated by ChunkTreeWalker::BuildTree(). Nodes
+        /// passed to a ChunkTreeWalker::Walk() visitor never have children.
+        std::vector<ChunkNode> children;
+
+        /// @brief Gets the container's form type as a string.
+        /// @return The ASCII form type, or an empty string if the chunk is
+        /// not a container.
+        std::string FormType() const;
+
+        /// @brief Finds the first chunk with the specified ID in the subtree.
+        ///
+        /// The search is depth first and includes this node itself.
+        ///
+        /// @param ID The ID of the chunk to find.
+        /// @return The matching node, or nullptr if none was found.
+        const ChunkNode* Find(std::string ID) const;
+    };
+
+    /// @brief Walks a tree of nested chunks, such as a RIFF file.
+    ///
+    /// Chunks whose ID is a known container ID (RIFF, RIFX and LIST by 
+    /// default) are treated as a four byte form type followed by child
+    /// chunks, which are walked before the container's next sibling. When 
+    /// padding is enabled, chunks with an odd sized payload are followed by
+    /// a pad byte, as the RIFF and IFF formats require.
+    ///
+    /// The walk is a single forward pass from the file's current offset: 
+    /// headers are read in file order and leaf payloads are skipped with a
+    /// forward seek, so the file is never revisited. Apart from building a
+    /// tree, the memory used is proportional to the nesting depth only.
+    class ChunkTreeWalker
+    {
+    public:
+        /// @brief Constructs a walker over the chunks in the specified file.
+        /// @param file The file to walk the chunks of.
+        /// @param endianness The endianness of the chunk sizes.
+        /// @invariant The file must outlive the walker.
+        ChunkTreeWalker(File* file, 
+            Endianness endianness = Endianness::Little);
+
+        /// @brief Treats chunks with the specified ID as containers.
+        /// @param ID The four character ID of the container (e.g. "FORM").
+        void AddContainerID(std::string ID);
+
+        /// @brief Determines if the specified chunk ID is a container ID.
+        /// @param id The raw bytes of the chunk ID.
+        /// @return True if chunks with the ID contain child chunks.
+        bool IsContainerID(const std::array<char, chunkIDSize>& id) const;
+
+        /// @brief Enables or disables even-byte padding (enabled by default).
+        /// @param enabled True if odd sized payloads are followed by a pad.
+        void SetPadding(bool enabled)
+        {
+            mIsPadded = enabled;
+        }
+
+        /// @brief Visits every chunk in the tree, depth first, in file order.
+        ///
+        /// Each container is visited before its children. While a chunk is 
+        /// visited, the offset is just past its header (and form type), but
+        /// the visitor must not change the offset. Once the walk ends, the 
+        /// offset is at the end of the last top level chunk.
+        ///
+        /// @param visitor The function to call for each chunk.
+        /// @pre The file must be opened for reading.
+        void Walk(std::function<void(const ChunkNode&)> visitor);
+
+        /// @brief Builds the whole chunk tree in a single pass.
+        /// @return The top level chunks, with their children populated.
+        /// @pre The file must be opened for reading.
+        std::vector<ChunkNode> BuildTree();
+    private:
+        File* mFile;
+        Endianness mEndianness;
+        bool mIsPadded;
+        std::vector<std::array<char, chunkIDSize>> mContainerIDs;
+        std::array<char, chunkHeaderSize> mHeaderBuffer;
+        std::array<char, chunkIDSize> mFormTypeBuffer;
+        RawFieldView mHeader;
+        RawFieldView mFormType;
+
+        std::size_t NextOffset(const ChunkInfo& chunk) const;
+    };
+}
+
+#endif
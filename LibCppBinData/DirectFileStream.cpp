@@ -0,0 +1,165 @@
+// DirectFileStream.cpp - Defines the DirectFileStream class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+#include "AlignedBuffer.h"
+#include "RawFieldView.h"
+#include "DirectFileStream.h"
+
+namespace BinData
+{
+    namespace
+    {
+        // The most data read through the bounce buffer at a time.
+        constexpr std::size_t bounceSize{ 1024 * 1024 };
+
+        bool IsAligned(std::size_t value)
+        {
+            return value % directAlignment == 0;
+        }
+    }
+
+    DirectFileStream::~DirectFileStream()
+    {
+        CloseDirect();
+    }
+
+    void DirectFileStream::Open(FileMode m)
+    {
+        PosixFileStream::Open(m);
+        mDirectFailed = false;
+        if (m != FileMode::Read)
+            return;
+
+        // Failing to open the direct descriptor is not an error, as reads
+        // can always go through the page cache instead.
+#if defined(O_DIRECT)
+        mDirectDescriptor = ::open(FileName().c_str(), O_RDONLY | O_DIRECT);
+#elif defined(F_NOCACHE)
+        mDirectDescriptor = ::open(FileName().c_str(), O_RDONLY);
+        if (mDirectDescriptor != -1 && 
+            ::fcntl(mDirectDescriptor, F_NOCACHE, 1) == -1)
+        {
+            CloseDirect();
+        }
+#endif
+    }
+
+    void DirectFileStream::Close()
+    {
+        CloseDirect();
+        PosixFileStream::Close();
+    }
+
+    void DirectFileStream::ReadAt(std::size_t offset, Field* f)
+    {
+        std::size_t size = f->Size();
+        std::size_t start = 
+            (offset + directAlignment - 1) / directAlignment * directAlignment;
+        std::size_t end = (offset + size) / directAlignment * directAlignment;
+        if (!IsDirect() || size < mThreshold || end <= start)
+        {
+            PosixFileStream::ReadAt(offset, f);
+            return;
+        }
+
+        char* data = f->Data();
+        if (start > offset)
+        {
+            RawFieldView head{ data, start - offset };
+            PosixFileStream::ReadAt(offset, &head);
+        }
+
+        char* middle = data + (start - offset);
+        if (!ReadDirect(start, middle, end - start))
+        {
+            RawFieldView fallback{ middle, end - start };
+            PosixFileStream::ReadAt(start, &fallback);
+        }
+
+        if (offset + size > end)
+        {
+            RawFieldView tail{ data + (end - offset), offset + size - end };
+            PosixFileStream::ReadAt(end, &tail);
+        }
+    }
+
+    void DirectFileStream::CloseDirect()
+    {
+        if (mDirectDescriptor != -1)
+            ::close(mDirectDescriptor);
+        mDirectDescriptor = -1;
+    }
+
+    bool DirectFileStream::ReadDirect(std::size_t offset, char* data, 
+        std::size_t size)
+    {
+        // The data can only be read in place if the memory is aligned too.
+        AlignedBuffer bounce;
+        bool inPlace = IsAligned(reinterpret_cast<std::uintptr_t>(data));
+        if (!inPlace)
+        {
+            bounce = AllocateAligned(std::min(size, bounceSize), 
+                directAlignment);
+        }
+
+        while (size > 0)
+        {
+            std::size_t request = inPlace ? size : std::min(size, bounceSize);
+            char* destination = inPlace ? data : bounce.get();
+            ssize_t count = ::pread(mDirectDescriptor, destination, request, 
+                static_cast<off_t>(offset));
+            if (count == -1 && errno == EINTR)
+                continue;
+
+            // The file system rejected the transfer after all, so stop
+            // trying and let the caller read it through the page cache.
+            if (count == -1 && errno == EINVAL)
+            {
+                mDirectFailed = true;
+                return false;
+            }
+            if (count == -1)
+                throw std::runtime_error{ "Unable to read from file" };
+            if (count == 0)
+                throw std::runtime_error{ "Cannot read beyond end of file" };
+
+            std::size_t transferred = static_cast<std::size_t>(count);
+            if (!inPlace)
+                std::memcpy(data, bounce.get(), transferred);
+            data += transferred;
+            offset += transferred;
+            size -= transferred;
+
+            // A short read leaves the next one unaligned, which direct I/O
+            // cannot do, so finish the rest through the page cache.
+            if (size > 0 && !IsAligned(offset))
+            {
+                RawFieldView rest{ data, size };
+                PosixFileStream::ReadAt(offset, &rest);
+                return true;
+            }
+        }
+
+        return true;
+    }
+}
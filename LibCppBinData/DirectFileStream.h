@@ -0,0 +1,105 @@
+// DirectFileStream.h - Declares the DirectFileStream class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIN_DATA_DIRECT_FILE_STREAM_H
+#define BIN_DATA_DIRECT_FILE_STREAM_H
+
+#include <cstddef>
+#include <string>
+#include <atomic>
+#include "PosixFileStream.h"
+
+namespace BinData
+{
+    /// @brief The alignment O_DIRECT transfers are made at, which suits the
+    /// logical block size of practically every device.
+    constexpr std::size_t directAlignment{ 4096 };
+
+    /// @brief The default size at which DirectFileStream reads bypass the
+    /// page cache.
+    constexpr std::size_t defaultDirectThreshold{ 64 * 1024 };
+
+    /// @brief A PosixFileStream whose large reads bypass the page cache.
+    ///
+    /// When the file is opened for reading, a second descriptor is opened
+    /// with O_DIRECT (or F_NOCACHE on macOS). Reads of at least the
+    /// threshold size transfer their aligned middle through it, straight
+    /// from the device, while their unaligned head and tail bytes, and all
+    /// smaller reads, go through the page cache as usual. A one pass read
+    /// of a huge payload therefore does not evict the data other processes
+    /// are relying on the page cache to hold.
+    ///
+    /// Reading into a RawField constructed with directAlignment transfers
+    /// the data without copying it. Other fields are filled through an 
+    /// aligned bounce buffer. If the file system does not support direct
+    /// I/O, every read goes through the page cache.
+    ///
+    /// @remark This class is only available on POSIX platforms.
+    class DirectFileStream : public PosixFileStream
+    {
+    public:
+        /// @brief Constructs a DirectFileStream.
+        /// @param fileName The name of the file.
+        /// @param threshold The smallest read, in bytes, that bypasses the
+        /// page cache.
+        DirectFileStream(std::string fileName, 
+            std::size_t threshold = defaultDirectThreshold)
+            : PosixFileStream{ fileName }, mDirectDescriptor{ -1 },
+            mThreshold{ threshold }, mDirectFailed{ false }
+        {
+
+        }
+
+        DirectFileStream(const DirectFileStream&) = delete;
+
+        DirectFileStream& operator=(const DirectFileStream&) = delete;
+
+        ~DirectFileStream();
+
+        /// @brief Determines if large reads are currently bypassing the 
+        /// page cache.
+        bool IsDirect() const
+        {
+            return mDirectDescriptor != -1 && !mDirectFailed;
+        }
+
+        /// @brief Gets the smallest read, in bytes, that bypasses the cache.
+        std::size_t Threshold() const
+        {
+            return mThreshold;
+        }
+
+        void Open(FileMode m = FileMode::Read) override;
+
+        void Close() override;
+
+        /// @brief Reads data at the specified offset, bypassing the page
+        /// cache for the aligned part of large reads.
+        /// @param offset The offset to read from.
+        /// @param f The field to read into.
+        void ReadAt(std::size_t offset, Field* f) override;
+    private:
+        int mDirectDescriptor;
+        std::size_t mThreshold;
+        std::atomic<bool> mDirectFailed;
+
+        void CloseDirect();
+
+        bool ReadDirect(std::size_t offset, char* data, std::size_t size);
+    };
+}
+
+#endif
@@ -17,6 +17,28 @@
 #ifndef BIN_DATA_ENDIANNESS_H
 #define BIN_DATA_ENDIANNESS_H
 
+#if __has_include(<bit>)
+#include <bit>
+#endif
+
+// Determine the byte order of the host at compile time. C++20's std::endian
+// is used when it is available, otherwise fall back on the macros GCC and
+// Clang predefine. Windows only runs on little endian hardware.
+#if defined(__cpp_lib_endian)
+#if __cpp_lib_endian >= 201907L
+#define BIN_DATA_BIG_ENDIAN_HOST (std::endian::native == std::endian::big)
+#endif
+#endif
+#if !defined(BIN_DATA_BIG_ENDIAN_HOST)
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__)
+#define BIN_DATA_BIG_ENDIAN_HOST (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#elif defined(_WIN32)
+#define BIN_DATA_BIG_ENDIAN_HOST false
+#else
+#error "Unable to determine the byte order of the host"
+#endif
+#endif
+
 namespace BinData
 {
     enum class Endianness
@@ -24,6 +46,10 @@ namespace BinData
         Little,
         Big
     };
+
+    /// @brief The endianness of the integers on the host system.
+    constexpr Endianness hostEndianness{ 
+        BIN_DATA_BIG_ENDIAN_HOST ? Endianness::Big : Endianness::Little };
 }
 
 #endif
\ No newline at end of file
@@ -15,6 +15,7 @@
 // limitations under the License.
 
 #include "FieldStruct.h"
+#include "FieldView.h"
 
 using namespace BinData;
 
@@ -24,4 +25,16 @@ std::size_t FieldStruct::TotalSize() const
     for (std::shared_ptr<Field> field : Fields())
         size += field->Size();
     return size;
-}   
\ No newline at end of file
+}
+
+void FieldStruct::Bind(char* data)
+{
+    for (std::shared_ptr<Field> field : Fields())
+    {
+        auto view = std::dynamic_pointer_cast<FieldView>(field);
+        if (view == nullptr)
+            throw InvalidField{ "Only FieldViews can be bound to data" };
+        view->Bind(data);
+        data += view->Size();
+    }
+}
@@ -18,6 +18,7 @@
 #define BIN_DATA_FIELD_STRUCT_H
 
 #include <vector>
+#include <memory>
 #include "Field.h"
 
 namespace BinData
@@ -25,9 +26,21 @@ namespace BinData
     class FieldStruct
     {
     public:
+        virtual ~FieldStruct() = default;
+
         virtual std::vector<std::shared_ptr<Field>> Fields() const = 0;
 
-        std::size_t TotalSize() const;
+        virtual std::size_t TotalSize() const;
+
+        /// @brief Binds the struct's fields to consecutive bytes of data.
+        ///
+        /// Walks the fields in order and points each one at the next
+        /// Size() bytes of data, so a struct made of FieldViews can decode
+        /// a caller supplied buffer in place without copying it.
+        ///
+        /// @param data A pointer to at least TotalSize() bytes of data.
+        /// @throw InvalidField when one of the fields is not a FieldView.
+        void Bind(char* data);
     };
 }
 
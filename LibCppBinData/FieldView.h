@@ -0,0 +1,63 @@
+// FieldView.h - Declares the FieldView abstract class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIN_DATA_FIELD_VIEW_H
+#define BIN_DATA_FIELD_VIEW_H
+
+#include <cstddef>
+#include "Field.h"
+
+namespace BinData
+{
+    /// @brief A field that does not own the data it refers to.
+    ///
+    /// Rather than allocating its own storage, a FieldView points directly
+    /// at bytes owned by someone else, such as a caller supplied buffer or
+    /// a memory mapped file. Copying a view copies the pointer, not the data.
+    /// The bytes must outlive the view and must not move while it is bound.
+    class FieldView : public Field
+    {
+    public:
+        FieldView() : mData{ nullptr } { }
+
+        FieldView(char* data) : mData{ data } { }
+
+        /// @brief Gets a raw pointer to the data the view is bound to.
+        /// @return The pointer to the bound data, or nullptr if unbound.
+        char* Data() override
+        {
+            return mData;
+        }
+
+        /// @brief Points the view at the specified data.
+        /// @param data A pointer to at least Size() bytes of data.
+        void Bind(char* data)
+        {
+            mData = data;
+        }
+
+        /// @brief Determines if the view is currently bound to any data.
+        /// @return True if the view is bound, otherwise false.
+        bool IsBound() const
+        {
+            return mData != nullptr;
+        }
+    protected:
+        char* mData;
+    };
+}
+
+#endif
@@ -27,6 +27,10 @@
 #include "FileStream.h"
 #include "FieldStruct.h"
 #include "ChunkHeader.h"
+#include "ChunkInfo.h"
+#include "ChunkRange.h"
+#include "FileCursor.h"
+#include "ReadRequest.h"
 
 namespace BinData
 {
@@ -61,6 +65,9 @@ namespace BinData
         /// Accepts a pointer to a binary data field and reads data from the 
         /// file at the current offset in an amount equal to the field size. 
         ///
+        /// If the field is a FieldView and the underlying stream keeps the
+        /// file in memory, the view is bound to the data in place instead.
+        ///
         /// @param f The pointer to the binary data field to read into.
         /// @pre The file must be opened for reading.
         /// @pre There must be enough data remaining at the current offset.
@@ -78,6 +85,44 @@ namespace BinData
         /// @post The offset must have advanced by field size.
         virtual void Write(Field* f) = 0;
 
+        /// @brief Reads data at the specified offset into the field.
+        ///
+        /// The current offset is neither used nor changed, so several
+        /// threads may read from the same open file at once.
+        ///
+        /// @param offset The offset to read from.
+        /// @param f The pointer to the binary data field to read into.
+        /// @pre The file must be opened for reading.
+        /// @pre There must be enough data remaining at the offset.
+        virtual void ReadAt(std::size_t offset, Field* f) = 0;
+
+        /// @brief Reads a batch of fields from arbitrary offsets.
+        ///
+        /// The requests are sorted by offset, and ranges that overlap or lie
+        /// within maxGap bytes of each other are fetched with one positional
+        /// read and copied out to their fields. Reading many small, sparse
+        /// fields this way costs a handful of large reads rather than a seek
+        /// and a small read for each field. Like ReadAt(), the current
+        /// offset is neither used nor changed.
+        ///
+        /// @param requests The offsets to read and the fields to read into.
+        /// @param maxGap The largest gap between ranges to read through.
+        /// @pre The file must be opened for reading.
+        /// @pre Every request must lie entirely within the file.
+        virtual void ReadMany(std::vector<ReadRequest> requests,
+            std::size_t maxGap = defaultReadGap) = 0;
+
+        /// @brief Writes the data in the field at the specified offset.
+        ///
+        /// The current offset is neither used nor changed, so several
+        /// threads may write disjoint ranges of the same open file at once.
+        ///
+        /// @param offset The offset to write to.
+        /// @param f The pointer to the binary data field to write.
+        /// @pre The file must be opened for writing.
+        /// @pre The offset must be no greater than file size.
+        virtual void WriteAt(std::size_t offset, Field* f) = 0;
+
         virtual void Read(FieldStruct* s) = 0;
 
         virtual void Write(FieldStruct* s) = 0;
@@ -86,6 +131,47 @@ namespace BinData
             BinData::Endianness endianness = BinData::Endianness::Little)
             = 0;
 
+        /// @brief Finds every chunk with the specified ID.
+        ///
+        /// Searches the chain of chunks that begins at the current offset.
+        /// The offset is left unchanged.
+        ///
+        /// @param ID The ID of the chunks to find.
+        /// @param endianness The endianness of the chunk sizes.
+        /// @return The matching chunks, in file order.
+        /// @pre The file must be opened for reading.
+        virtual std::vector<ChunkInfo> FindChunks(std::string ID,
+            BinData::Endianness endianness = BinData::Endianness::Little)
+            = 0;
+
+        /// @brief Gets a lazy range over the chunks in the file.
+        ///
+        /// The range walks the chain of chunks that begins at the current
+        /// offset, reading each header only as the range is iterated. See
+        /// ChunkRange for how iteration moves the offset.
+        ///
+        /// @param endianness The endianness of the chunk sizes.
+        /// @return A single-pass range of ChunkInfo descriptors.
+        /// @pre The file must be opened for reading.
+        ChunkRange Chunks(
+            BinData::Endianness endianness = BinData::Endianness::Little)
+        {
+            return ChunkRange{ this, endianness };
+        }
+
+        /// @brief Creates an independent read cursor over the file.
+        ///
+        /// The cursor reads with ReadAt(), so it neither uses nor moves the
+        /// file's own offset. See FileCursor.
+        ///
+        /// @param offset The offset the cursor starts at.
+        /// @return The new cursor.
+        /// @pre Offset must not be greater than the file size.
+        FileCursor Cursor(std::size_t offset = 0)
+        {
+            return FileCursor{ this, offset };
+        }
+
         virtual std::string Name() const = 0;
 
         // @brief Gets the size of the file.
@@ -110,6 +196,18 @@ namespace BinData
         /// @brief Closes the file.
         virtual void Close() = 0;
 
+        /// @brief Writes any buffered data to the file without closing it.
+        virtual void Flush() = 0;
+
+        /// @brief Tells the file how it, or a range of it, is about to be
+        /// accessed. See FileStream::Advise().
+        /// @param pattern The expected access pattern.
+        /// @param offset The offset of the range the hint applies to.
+        /// @param size The size of the range, or zero for the rest of the
+        /// file.
+        virtual void Advise(AccessPattern pattern, std::size_t offset = 0,
+            std::size_t size = 0) = 0;
+
         /// @brief Sets the offset to perform the next read or write operation
         /// @param offset The offset to start the next read or write operation
         /// @pre Offset must not be greater than equal to the file size
@@ -0,0 +1,64 @@
+// FileCursor.cpp - Defines the FileCursor class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissionsand
+// limitations under the License.
+
+#include "FileCursor.h"
+#include "File.h"
+#include "PackedFieldStruct.h"
+
+namespace BinData
+{
+    FileCursor::FileCursor(File* file, std::size_t offset) 
+        : mFile{ file }, mOffset{ 0 }
+    {
+        if (mFile == nullptr)
+            throw InvalidFile{ "file cannot be null" };
+        SetOffset(offset);
+    }
+
+    void FileCursor::Read(Field* f)
+    {
+        mFile->ReadAt(mOffset, f);
+        mOffset += f->Size();
+    }
+
+    void FileCursor::Read(FieldStruct* s)
+    {
+        // As with RawFile, a packed struct is read in one go through its
+        // contiguous buffer.
+        auto packed = dynamic_cast<PackedFieldStruct*>(s);
+        if (packed != nullptr)
+        {
+            if (packed->TotalSize() > 0)
+                Read(packed->Buffer());
+            return;
+        }
+
+        for (std::shared_ptr<Field> f : s->Fields())
+            Read(f.get());
+    }
+
+    void FileCursor::SetOffset(std::size_t offset)
+    {
+        if (offset > mFile->Size())
+            throw InvalidFileOperation{ "Offset cannot be beyond file size" };
+        mOffset = offset;
+    }
+
+    std::size_t FileCursor::Size() const
+    {
+        return mFile->Size();
+    }
+}
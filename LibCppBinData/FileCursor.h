@@ -0,0 +1,86 @@
+// FileCursor.h - Declares the FileCursor class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissionsand
+// limitations under the License.
+
+#ifndef BIN_DATA_FILE_CURSOR_H
+#define BIN_DATA_FILE_CURSOR_H
+
+#include <cstddef>
+#include "Field.h"
+#include "FieldStruct.h"
+
+namespace BinData
+{
+    class File;
+
+    /// @brief An independent read position within an open file.
+    ///
+    /// A cursor carries its own offset and reads through File::ReadAt(),
+    /// so any number of cursors can share one open file without moving its
+    /// offset or each other's. Handing one cursor to each worker thread
+    /// avoids reopening the file per thread; whether the reads actually
+    /// run in parallel depends on the file's stream (see FileStream).
+    ///
+    /// Cursors are cheap to create and copy. A copy continues from the 
+    /// same offset but moves independently from then on.
+    class FileCursor
+    {
+    public:
+        /// @brief Constructs a cursor over the specified file.
+        /// @param file The file to read from.
+        /// @param offset The offset the cursor starts at.
+        /// @invariant The file must outlive the cursor.
+        FileCursor(File* file, std::size_t offset = 0);
+
+        /// @brief Reads data from the file into the specified field.
+        ///
+        /// Views must already be bound to a buffer, since the data is
+        /// always copied rather than bound in place.
+        ///
+        /// @param f The pointer to the binary data field to read into.
+        /// @pre The file must be opened for reading.
+        /// @pre There must be enough data remaining at the cursor's offset.
+        /// @post The cursor's offset has advanced by field size.
+        void Read(Field* f);
+
+        /// @brief Reads data from the file into each field of the struct.
+        /// @param s The pointer to the struct to read into.
+        /// @pre The file must be opened for reading.
+        /// @pre There must be enough data remaining at the cursor's offset.
+        /// @post The cursor's offset has advanced by the struct's size.
+        void Read(FieldStruct* s);
+
+        /// @brief Gets the cursor's current offset.
+        /// @return The offset the next read will start at.
+        std::size_t Offset() const
+        {
+            return mOffset;
+        }
+
+        /// @brief Sets the offset to perform the next read operation at.
+        /// @param offset The offset to start the next read operation at.
+        /// @pre Offset must not be greater than the file size.
+        void SetOffset(std::size_t offset);
+
+        /// @brief Gets the size of the file the cursor reads from.
+        /// @return The size of the file.
+        std::size_t Size() const;
+    private:
+        File* mFile;
+        std::size_t mOffset;
+    };
+}
+
+#endif
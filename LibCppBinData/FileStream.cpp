@@ -32,4 +32,49 @@ bool FileStream::IsAtEnd() const
         return true;
     else
         return false;
-}
\ No newline at end of file
+}
+
+char* FileStream::ReadView(std::size_t)
+{
+    return nullptr;
+}
+
+void FileStream::ReadV(const std::vector<Field*>& fields)
+{
+    for (Field* f : fields)
+        Read(f);
+}
+
+void FileStream::WriteV(const std::vector<Field*>& fields)
+{
+    for (Field* f : fields)
+        Write(f);
+}
+
+void FileStream::Flush()
+{
+
+}
+
+void FileStream::Advise(AccessPattern, std::size_t, std::size_t)
+{
+
+}
+
+void FileStream::ReadAt(std::size_t offset, Field* f)
+{
+    std::lock_guard<std::mutex> lock{ mPositionalMutex };
+    std::size_t previousOffset = Offset();
+    SetOffset(offset);
+    Read(f);
+    SetOffset(previousOffset);
+}
+
+void FileStream::WriteAt(std::size_t offset, Field* f)
+{
+    std::lock_guard<std::mutex> lock{ mPositionalMutex };
+    std::size_t previousOffset = Offset();
+    SetOffset(offset);
+    Write(f);
+    SetOffset(previousOffset);
+}
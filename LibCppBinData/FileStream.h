@@ -19,6 +19,8 @@
 
 #include <cstddef>
 #include <string>
+#include <vector>
+#include <mutex>
 #include "Field.h"
 
 namespace BinData
@@ -31,9 +33,36 @@ namespace BinData
         ReadWrite
     };
 
+    /// @brief How a file, or a range of it, is about to be accessed.
+    enum class AccessPattern
+    {
+        /// @brief No particular pattern; undoes Sequential and Random.
+        Normal,
+
+        /// @brief The file will be read from start to end, so read ahead
+        /// aggressively.
+        Sequential,
+
+        /// @brief The file will be read at scattered offsets, so do not read
+        /// ahead.
+        Random,
+
+        /// @brief The range will be read soon, so start fetching it now.
+        WillNeed,
+
+        /// @brief The range will not be read again soon, so release any
+        /// memory caching it.
+        DontNeed
+    };
+
     class FileStream
     {
     public:
+        // Streams may buffer writes or hold descriptors and mappings that
+        // they release on destruction, so they must be destroyable through
+        // a pointer to the base class.
+        virtual ~FileStream() = default;
+
         virtual std::string FileName() const = 0;
 
         virtual bool IsOpen() const = 0;
@@ -59,6 +88,86 @@ namespace BinData
         virtual void Write(Field* f) = 0;
 
         virtual void SetOffset(std::size_t o) = 0;
+
+        /// @brief Reads data into each of the fields in turn.
+        ///
+        /// Equivalent to calling Read() on each field in order, but streams
+        /// that support scatter/gather I/O override it to fill every field
+        /// with a single call.
+        ///
+        /// @param fields The fields to read into, in file order.
+        virtual void ReadV(const std::vector<Field*>& fields);
+
+        /// @brief Writes the data in each of the fields in turn.
+        ///
+        /// Equivalent to calling Write() on each field in order, but streams
+        /// that support scatter/gather I/O override it to write every field
+        /// with a single call.
+        ///
+        /// @param fields The fields to write, in file order.
+        virtual void WriteV(const std::vector<Field*>& fields);
+
+        /// @brief Writes any data the stream is holding back to the file.
+        ///
+        /// Streams that gather small writes in memory hand them to the
+        /// operating system here. The default implementation does nothing,
+        /// which suits streams that never buffer writes.
+        virtual void Flush();
+
+        /// @brief Tells the stream how the file is about to be accessed.
+        ///
+        /// This is only a hint, which streams are free to ignore, and never
+        /// changes the data that is read. Streams built on a file descriptor
+        /// pass it to posix_fadvise(), and memory mapped streams to 
+        /// madvise(). The default implementation ignores it.
+        ///
+        /// @param pattern The expected access pattern.
+        /// @param offset The offset of the range the hint applies to.
+        /// @param size The size of the range, or zero for the rest of the
+        /// file. Sequential, Random and Normal usually apply to the whole
+        /// file regardless.
+        virtual void Advise(AccessPattern pattern, std::size_t offset = 0,
+            std::size_t size = 0);
+
+        /// @brief Gets direct access to data at the current offset.
+        ///
+        /// Streams that keep the file contents in memory can return a
+        /// pointer to size bytes at the current offset and advance the
+        /// offset past them, letting FieldViews bind to the data in place.
+        /// The pointer is only valid until the stream is closed or grown.
+        ///
+        /// @param size The number of bytes to access.
+        /// @return A pointer to the data, or nullptr if the stream does not
+        /// support direct access, in which case the offset is unchanged.
+        virtual char* ReadView(std::size_t size);
+
+        /// @brief Reads data at the specified offset into the field.
+        ///
+        /// Unlike Read(), a positional read neither uses nor moves the
+        /// current offset, so it can be used by several threads at once.
+        /// The default implementation emulates it by seeking and restoring
+        /// the offset under a lock, which makes concurrent positional reads
+        /// safe but serializes them. Streams that can read without a shared
+        /// cursor override it to avoid the lock.
+        ///
+        /// Positional reads must not be mixed with concurrent calls to the
+        /// offset based methods on another thread.
+        ///
+        /// @param offset The offset to read from.
+        /// @param f The field to read into.
+        virtual void ReadAt(std::size_t offset, Field* f);
+
+        /// @brief Writes the data in the field at the specified offset.
+        ///
+        /// The positional counterpart of Write(), which neither uses nor
+        /// moves the current offset. As with ReadAt(), the default
+        /// implementation seeks and restores the offset under a lock.
+        ///
+        /// @param offset The offset to write to.
+        /// @param f The field to write.
+        virtual void WriteAt(std::size_t offset, Field* f);
+    private:
+        std::mutex mPositionalMutex;
     };
 }
 
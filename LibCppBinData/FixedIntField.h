@@ -0,0 +1,130 @@
+// FixedIntField.h - Declares the FixedIntField class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIN_DATA_FIXED_INT_FIELD_H
+#define BIN_DATA_FIXED_INT_FIELD_H
+
+#include <cstddef>
+#include <array>
+#include <iostream>
+#include "IntFieldBase.h"
+#include "Endianness.h"
+#include "IntConversion.h"
+
+namespace BinData
+{
+    /// @brief An integer field whose endianness is fixed at compile time.
+    ///
+    /// Most formats store every integer in a single byte order that is known
+    /// when the schema is written, such as little endian for RIFF or big
+    /// endian for AIFF and RIFX. Making the endianness a template parameter
+    /// lets Value() and SetValue() pick their conversion at compile time
+    /// rather than checking a runtime flag on every call. Like
+    /// InlineIntField, the data is stored inside the field itself.
+    ///
+    /// @tparam ValueType The native integer type values are read as.
+    /// @tparam size The size of the field, in bytes.
+    /// @tparam endian The endianness the data is stored in.
+    template<typename ValueType, std::size_t size, Endianness endian>
+    class FixedIntField 
+        : public IntFieldBase<FixedIntField<ValueType, size, endian>>
+    {
+    public:
+        FixedIntField() : data{}
+        {
+
+        }
+
+        FixedIntField(ValueType value) : data{}
+        {
+            SetValue(value);
+        }
+
+        static constexpr Endianness Endian()
+        {
+            return endian;
+        }
+
+        /// @brief Gets the size of the field, in bytes.
+        /// @return The size of the field, in bytes.
+        std::size_t Size() const override
+        {
+            return size;
+        }
+
+        /// @brief Gets the value of the data as a native integer type.
+        /// @return The value of the data, decoded in the field's endianness.
+        ValueType Value() const
+        {
+            return DecodeInt<ValueType, size, endian>(data.data());
+        }
+
+        /// @brief Gets a raw pointer to the underlying data.
+        ///
+        /// The pointer is into the field itself, so it must not be used
+        /// once the field has been destroyed or goes out of scope.
+        ///
+        /// @return The raw pointer to the underlying data.
+        char* Data() override
+        {
+            return data.data();
+        }
+
+        /// @brief Prints the value of the field in decimal.
+        /// @param os The stream to print the value to.
+        void Print(std::ostream& os) const
+        {
+            os << Value();
+        }
+
+        /// @brief Sets the field to the value of the specified integer.
+        /// @param v The value to set the field to.
+        void SetValue(ValueType v)
+        {
+            EncodeInt<ValueType, size, endian>(data.data(), v);
+        }
+    private:
+        std::array<char, size> data;
+    };
+
+    template<typename ValueType, std::size_t size>
+    using LEIntField = FixedIntField<ValueType, size, Endianness::Little>;
+
+    template<typename ValueType, std::size_t size>
+    using BEIntField = FixedIntField<ValueType, size, Endianness::Big>;
+
+    using UInt16LEField = LEIntField<unsigned int, 2>;
+    using UInt24LEField = LEIntField<unsigned long, 3>;
+    using UInt32LEField = LEIntField<unsigned long, 4>;
+    using UInt64LEField = LEIntField<unsigned long long, 8>;
+
+    using Int16LEField = LEIntField<int, 2>;
+    using Int24LEField = LEIntField<long, 3>;
+    using Int32LEField = LEIntField<long, 4>;
+    using Int64LEField = LEIntField<long long, 8>;
+
+    using UInt16BEField = BEIntField<unsigned int, 2>;
+    using UInt24BEField = BEIntField<unsigned long, 3>;
+    using UInt32BEField = BEIntField<unsigned long, 4>;
+    using UInt64BEField = BEIntField<unsigned long long, 8>;
+
+    using Int16BEField = BEIntField<int, 2>;
+    using Int24BEField = BEIntField<long, 3>;
+    using Int32BEField = BEIntField<long, 4>;
+    using Int64BEField = BEIntField<long long, 8>;
+}
+
+#endif
@@ -0,0 +1,123 @@
+// InlineIntField.h - Declares the InlineIntField class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIN_DATA_INLINE_INT_FIELD_H
+#define BIN_DATA_INLINE_INT_FIELD_H
+
+#include <cstddef>
+#include <array>
+#include <iostream>
+#include "IntFieldBase.h"
+#include "Endianness.h"
+#include "IntConversion.h"
+
+namespace BinData
+{
+    /// @brief An IntField that stores its bytes inside the object.
+    ///
+    /// IntField allocates its data on the heap, so every field costs an
+    /// allocation to construct or copy, and moving one leaves it empty.
+    /// An InlineIntField keeps its bytes in a std::array instead, so it
+    /// never allocates, copying or moving it is a plain copy of a few bytes,
+    /// and an array of them keeps its data contiguous. Its data is never
+    /// null, so Value() never throws.
+    ///
+    /// @tparam ValueType The native integer type values are read as.
+    /// @tparam size The size of the field, in bytes.
+    template<typename ValueType, std::size_t size>
+    class InlineIntField 
+        : public IntFieldBase<InlineIntField<ValueType, size>>
+    {
+    public:
+        InlineIntField(Endianness endian = Endianness::Little)
+            : data{}, endian{ endian }
+        {
+
+        }
+
+        InlineIntField(ValueType value, Endianness endian = Endianness::Little)
+            : data{}, endian{ endian }
+        {
+            SetValue(value);
+        }
+
+        Endianness Endian() const
+        {
+            return endian;
+        }
+
+        /// @brief Gets the size of the field, in bytes.
+        /// @return The size of the field, in bytes.
+        std::size_t Size() const override
+        {
+            return size;
+        }
+
+        /// @brief Gets the value of the data as a native integer type.
+        /// @return The value of the data, decoded in the field's endianness.
+        ValueType Value() const
+        {
+            return DecodeInt<ValueType, size>(data.data(), endian);
+        }
+
+        /// @brief Gets a raw pointer to the underlying data.
+        ///
+        /// The pointer is into the field itself, so it must not be used
+        /// once the field has been destroyed or goes out of scope.
+        ///
+        /// @return The raw pointer to the underlying data.
+        char* Data() override
+        {
+            return data.data();
+        }
+
+        void SetEndian(Endianness endian)
+        {
+            this->endian = endian;
+        }
+
+        /// @brief Prints the value of the field in decimal.
+        /// @param os The stream to print the value to.
+        void Print(std::ostream& os) const
+        {
+            os << Value();
+        }
+
+        /// @brief Sets the field to the value of the specified integer.
+        /// @param v The value to set the field to.
+        void SetValue(ValueType v)
+        {
+            EncodeInt<ValueType, size>(data.data(), v, endian);
+        }
+    private:
+        std::array<char, size> data;
+        Endianness endian;
+    };
+
+    using UInt8InlineField = InlineIntField<unsigned int, 1>;
+    using UInt16InlineField = InlineIntField<unsigned int, 2>;
+    using UInt24InlineField = InlineIntField<unsigned long, 3>;
+    using UInt32InlineField = InlineIntField<unsigned long, 4>;
+    using UInt64InlineField = InlineIntField<unsigned long long, 8>;
+
+    using Int8InlineField = InlineIntField<int, 1>;
+    using Int16InlineField = InlineIntField<int, 2>;
+    using Int24InlineField = InlineIntField<long, 3>;
+    using Int32InlineField = InlineIntField<long, 4>;
+    using Int64InlineField = InlineIntField<long long, 8>;
+}
+
+#endif
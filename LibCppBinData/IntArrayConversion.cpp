@@ -0,0 +1,473 @@
+// IntArrayConversion.cpp - Defines the integer array conversion functions.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include "IntArrayConversion.h"
+#include "IntConversion.h"
+
+// The x86 kernels are compiled with per function target attributes, so the
+// rest of the library does not need to be built for a newer processor than
+// the one it runs on. The host is checked at run time before they are used.
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define BIN_DATA_X86_SIMD
+#include <immintrin.h>
+#endif
+
+// NEON is part of the baseline of every AArch64 processor. The shuffles
+// assume the vector lanes are stored little endian.
+#if defined(__aarch64__) && defined(__ARM_NEON) && !defined(__ARM_BIG_ENDIAN)
+#define BIN_DATA_NEON_SIMD
+#include <arm_neon.h>
+#endif
+
+namespace BinData
+{
+    namespace
+    {
+        SimdLevel DetectSimdLevel()
+        {
+#if defined(BIN_DATA_X86_SIMD)
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2"))
+                return SimdLevel::Avx2;
+            if (__builtin_cpu_supports("ssse3"))
+                return SimdLevel::Ssse3;
+#elif defined(BIN_DATA_NEON_SIMD)
+            return SimdLevel::Neon;
+#endif
+            return SimdLevel::Scalar;
+        }
+
+        std::atomic<SimdLevel>& ActiveLevel()
+        {
+            static std::atomic<SimdLevel> level{ SupportedSimdLevel() };
+            return level;
+        }
+
+        // [Scalar kernels]
+        // These convert whatever the vector kernels leave over at the end
+        // of an array, and every array on hosts without a vector unit.
+
+        template<typename UIntType>
+        void SwapScalar(const char* source, char* destination, 
+            std::size_t count)
+        {
+            for (std::size_t i = 0; i < count; i++)
+            {
+                UIntType value;
+                std::memcpy(&value, source + i * sizeof(value), sizeof(value));
+                value = ByteSwap(value);
+                std::memcpy(destination + i * sizeof(value), &value, 
+                    sizeof(value));
+            }
+        }
+
+        void Expand24Scalar(const char* source, std::uint32_t* destination,
+            std::size_t count, Endianness endian, bool isSigned)
+        {
+            for (std::size_t i = 0; i < count; i++)
+            {
+                const char* data = source + i * 3;
+                std::uint32_t raw = endian == Endianness::Little ? 
+                    LoadLE<3>(data) : LoadBE<3>(data);
+                destination[i] = isSigned ? static_cast<std::uint32_t>(
+                    ExtendInt<std::int32_t, 3>(raw)) : raw;
+            }
+        }
+
+        void Pack24Scalar(const std::uint32_t* source, char* destination,
+            std::size_t count, Endianness endian)
+        {
+            for (std::size_t i = 0; i < count; i++)
+            {
+                if (endian == Endianness::Little)
+                    StoreLE<3>(destination + i * 3, source[i]);
+                else
+                    StoreBE<3>(destination + i * 3, source[i]);
+            }
+        }
+
+#if defined(BIN_DATA_X86_SIMD)
+        // [SSSE3 and AVX2 kernels]
+        // Each kernel converts as many whole vectors as it can and returns
+        // the number of integers it converted, leaving the rest to the next
+        // narrower kernel. PSHUFB moves every byte of a vector to the 
+        // position given by a mask, or zeroes it when the mask byte is -1.
+
+        __attribute__((target("ssse3")))
+        __m128i SwapMask(std::size_t size)
+        {
+            if (size == 2)
+                return _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 
+                    9, 8, 11, 10, 13, 12, 15, 14);
+            else if (size == 4)
+                return _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 
+                    11, 10, 9, 8, 15, 14, 13, 12);
+            else
+                return _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 
+                    15, 14, 13, 12, 11, 10, 9, 8);
+        }
+
+        __attribute__((target("ssse3")))
+        std::size_t SwapSsse3(const char* source, char* destination,
+            std::size_t bytes, std::size_t size)
+        {
+            __m128i mask = SwapMask(size);
+            std::size_t i = 0;
+            for (; i + 16 <= bytes; i += 16)
+            {
+                auto v = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(source + i));
+                v = _mm_shuffle_epi8(v, mask);
+                _mm_storeu_si128(
+                    reinterpret_cast<__m128i*>(destination + i), v);
+            }
+            return i;
+        }
+
+        __attribute__((target("avx2")))
+        std::size_t SwapAvx2(const char* source, char* destination,
+            std::size_t bytes, std::size_t size)
+        {
+            // VPSHUFB shuffles each 128-bit lane separately, so the same
+            // mask is simply repeated in both lanes.
+            __m256i mask = _mm256_broadcastsi128_si256(SwapMask(size));
+            std::size_t i = 0;
+            for (; i + 32 <= bytes; i += 32)
+            {
+                auto v = _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(source + i));
+                v = _mm256_shuffle_epi8(v, mask);
+                _mm256_storeu_si256(
+                    reinterpret_cast<__m256i*>(destination + i), v);
+            }
+            return i + SwapSsse3(source + i, destination + i, bytes - i, size);
+        }
+
+        // Moves each 3 byte integer into the top 3 bytes of a 32-bit lane
+        // so that a single shift right both positions it and, for signed
+        // integers, sign extends it.
+        __attribute__((target("ssse3")))
+        __m128i ExpandMask(Endianness endian)
+        {
+            if (endian == Endianness::Little)
+                return _mm_setr_epi8(-1, 0, 1, 2, -1, 3, 4, 5, 
+                    -1, 6, 7, 8, -1, 9, 10, 11);
+            else
+                return _mm_setr_epi8(-1, 2, 1, 0, -1, 5, 4, 3, 
+                    -1, 8, 7, 6, -1, 11, 10, 9);
+        }
+
+        __attribute__((target("ssse3")))
+        __m128i PackMask(Endianness endian)
+        {
+            if (endian == Endianness::Little)
+                return _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 
+                    10, 12, 13, 14, -1, -1, -1, -1);
+            else
+                return _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 
+                    8, 14, 13, 12, -1, -1, -1, -1);
+        }
+
+        __attribute__((target("ssse3")))
+        std::size_t Expand24Ssse3(const char* source, 
+            std::uint32_t* destination, std::size_t count, Endianness endian,
+            bool isSigned)
+        {
+            // Four integers only fill 12 bytes of each 16 byte load, so stop
+            // while the load still fits inside the source array.
+            __m128i mask = ExpandMask(endian);
+            std::size_t i = 0;
+            for (; i + 6 <= count; i += 4)
+            {
+                auto v = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(source + i * 3));
+                v = _mm_shuffle_epi8(v, mask);
+                v = isSigned ? _mm_srai_epi32(v, 8) : _mm_srli_epi32(v, 8);
+                _mm_storeu_si128(
+                    reinterpret_cast<__m128i*>(destination + i), v);
+            }
+            return i;
+        }
+
+        __attribute__((target("avx2")))
+        std::size_t Expand24Avx2(const char* source, 
+            std::uint32_t* destination, std::size_t count, Endianness endian,
+            bool isSigned)
+        {
+            __m256i mask = _mm256_broadcastsi128_si256(ExpandMask(endian));
+            std::size_t i = 0;
+            for (; i + 10 <= count; i += 8)
+            {
+                auto low = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(source + i * 3));
+                auto high = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(source + i * 3 + 12));
+                auto v = _mm256_inserti128_si256(
+                    _mm256_castsi128_si256(low), high, 1);
+                v = _mm256_shuffle_epi8(v, mask);
+                v = isSigned ? _mm256_srai_epi32(v, 8) : 
+                    _mm256_srli_epi32(v, 8);
+                _mm256_storeu_si256(
+                    reinterpret_cast<__m256i*>(destination + i), v);
+            }
+            return i + Expand24Ssse3(source + i * 3, destination + i, 
+                count - i, endian, isSigned);
+        }
+
+        __attribute__((target("ssse3")))
+        std::size_t Pack24Ssse3(const std::uint32_t* source, 
+            char* destination, std::size_t count, Endianness endian)
+        {
+            // Each store writes 4 bytes past the 12 that were packed, which
+            // the next store overwrites, so stop while it fits in the array.
+            __m128i mask = PackMask(endian);
+            std::size_t i = 0;
+            for (; i + 6 <= count; i += 4)
+            {
+                auto v = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(source + i));
+                v = _mm_shuffle_epi8(v, mask);
+                _mm_storeu_si128(
+                    reinterpret_cast<__m128i*>(destination + i * 3), v);
+            }
+            return i;
+        }
+
+        __attribute__((target("avx2")))
+        std::size_t Pack24Avx2(const std::uint32_t* source, 
+            char* destination, std::size_t count, Endianness endian)
+        {
+            __m256i mask = _mm256_broadcastsi128_si256(PackMask(endian));
+            std::size_t i = 0;
+            for (; i + 10 <= count; i += 8)
+            {
+                auto v = _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(source + i));
+                v = _mm256_shuffle_epi8(v, mask);
+                _mm_storeu_si128(
+                    reinterpret_cast<__m128i*>(destination + i * 3), 
+                    _mm256_castsi256_si128(v));
+                _mm_storeu_si128(
+                    reinterpret_cast<__m128i*>(destination + i * 3 + 12), 
+                    _mm256_extracti128_si256(v, 1));
+            }
+            return i + Pack24Ssse3(source + i, destination + i * 3, 
+                count - i, endian);
+        }
+#endif
+
+#if defined(BIN_DATA_NEON_SIMD)
+        // [NEON kernels]
+        // TBL zeroes the bytes whose index is out of range, which plays the
+        // same role as the -1 entries of the x86 masks.
+
+        std::size_t SwapNeon(const char* source, char* destination,
+            std::size_t bytes, std::size_t size)
+        {
+            auto in = reinterpret_cast<const std::uint8_t*>(source);
+            auto out = reinterpret_cast<std::uint8_t*>(destination);
+            std::size_t i = 0;
+            for (; i + 16 <= bytes; i += 16)
+            {
+                uint8x16_t v = vld1q_u8(in + i);
+                if (size == 2)
+                    v = vrev16q_u8(v);
+                else if (size == 4)
+                    v = vrev32q_u8(v);
+                else
+                    v = vrev64q_u8(v);
+                vst1q_u8(out + i, v);
+            }
+            return i;
+        }
+
+        std::size_t Expand24Neon(const char* source, 
+            std::uint32_t* destination, std::size_t count, Endianness endian,
+            bool isSigned)
+        {
+            static const std::uint8_t littleMask[16]{ 0xFF, 0, 1, 2, 
+                0xFF, 3, 4, 5, 0xFF, 6, 7, 8, 0xFF, 9, 10, 11 };
+            static const std::uint8_t bigMask[16]{ 0xFF, 2, 1, 0, 
+                0xFF, 5, 4, 3, 0xFF, 8, 7, 6, 0xFF, 11, 10, 9 };
+            uint8x16_t mask = vld1q_u8(endian == Endianness::Little ? 
+                littleMask : bigMask);
+            auto in = reinterpret_cast<const std::uint8_t*>(source);
+            std::size_t i = 0;
+            for (; i + 6 <= count; i += 4)
+            {
+                uint8x16_t v = vqtbl1q_u8(vld1q_u8(in + i * 3), mask);
+                uint32x4_t result = isSigned ? 
+                    vreinterpretq_u32_s32(vshrq_n_s32(
+                        vreinterpretq_s32_u8(v), 8)) :
+                    vshrq_n_u32(vreinterpretq_u32_u8(v), 8);
+                vst1q_u32(destination + i, result);
+            }
+            return i;
+        }
+
+        std::size_t Pack24Neon(const std::uint32_t* source, 
+            char* destination, std::size_t count, Endianness endian)
+        {
+            static const std::uint8_t littleMask[16]{ 0, 1, 2, 4, 5, 6, 
+                8, 9, 10, 12, 13, 14, 0xFF, 0xFF, 0xFF, 0xFF };
+            static const std::uint8_t bigMask[16]{ 2, 1, 0, 6, 5, 4, 
+                10, 9, 8, 14, 13, 12, 0xFF, 0xFF, 0xFF, 0xFF };
+            uint8x16_t mask = vld1q_u8(endian == Endianness::Little ? 
+                littleMask : bigMask);
+            auto out = reinterpret_cast<std::uint8_t*>(destination);
+            std::size_t i = 0;
+            for (; i + 6 <= count; i += 4)
+            {
+                uint8x16_t v = vreinterpretq_u8_u32(vld1q_u32(source + i));
+                vst1q_u8(out + i * 3, vqtbl1q_u8(v, mask));
+            }
+            return i;
+        }
+#endif
+
+        // Converts as much of the array as the active instruction set can,
+        // then finishes the remainder with the scalar kernel.
+        template<typename UIntType>
+        void Swap(const char* source, char* destination, std::size_t count)
+        {
+            constexpr std::size_t size = sizeof(UIntType);
+            std::size_t bytes = count * size;
+            std::size_t done = 0;
+            switch (ActiveSimdLevel())
+            {
+#if defined(BIN_DATA_X86_SIMD)
+            case SimdLevel::Avx2:
+                done = SwapAvx2(source, destination, bytes, size);
+                break;
+            case SimdLevel::Ssse3:
+                done = SwapSsse3(source, destination, bytes, size);
+                break;
+#endif
+#if defined(BIN_DATA_NEON_SIMD)
+            case SimdLevel::Neon:
+                done = SwapNeon(source, destination, bytes, size);
+                break;
+#endif
+            default:
+                break;
+            }
+            SwapScalar<UIntType>(source + done, destination + done, 
+                count - done / size);
+        }
+    }
+
+    SimdLevel SupportedSimdLevel()
+    {
+        static const SimdLevel level{ DetectSimdLevel() };
+        return level;
+    }
+
+    bool IsSimdLevelSupported(SimdLevel level)
+    {
+        switch (level)
+        {
+        case SimdLevel::Scalar:
+            return true;
+        case SimdLevel::Ssse3:
+            return SupportedSimdLevel() == SimdLevel::Ssse3 || 
+                SupportedSimdLevel() == SimdLevel::Avx2;
+        default:
+            return SupportedSimdLevel() == level;
+        }
+    }
+
+    SimdLevel ActiveSimdLevel()
+    {
+        return ActiveLevel().load(std::memory_order_relaxed);
+    }
+
+    bool SetSimdLevel(SimdLevel level)
+    {
+        if (!IsSimdLevelSupported(level))
+            return false;
+        ActiveLevel().store(level, std::memory_order_relaxed);
+        return true;
+    }
+
+    void SwapBytes16(const char* source, char* destination, std::size_t count)
+    {
+        Swap<std::uint16_t>(source, destination, count);
+    }
+
+    void SwapBytes32(const char* source, char* destination, std::size_t count)
+    {
+        Swap<std::uint32_t>(source, destination, count);
+    }
+
+    void SwapBytes64(const char* source, char* destination, std::size_t count)
+    {
+        Swap<std::uint64_t>(source, destination, count);
+    }
+
+    void Expand24(const char* source, std::uint32_t* destination, 
+        std::size_t count, Endianness endian, bool isSigned)
+    {
+        std::size_t done = 0;
+        switch (ActiveSimdLevel())
+        {
+#if defined(BIN_DATA_X86_SIMD)
+        case SimdLevel::Avx2:
+            done = Expand24Avx2(source, destination, count, endian, isSigned);
+            break;
+        case SimdLevel::Ssse3:
+            done = Expand24Ssse3(source, destination, count, endian, isSigned);
+            break;
+#endif
+#if defined(BIN_DATA_NEON_SIMD)
+        case SimdLevel::Neon:
+            done = Expand24Neon(source, destination, count, endian, isSigned);
+            break;
+#endif
+        default:
+            break;
+        }
+        Expand24Scalar(source + done * 3, destination + done, count - done,
+            endian, isSigned);
+    }
+
+    void Pack24(const std::uint32_t* source, char* destination, 
+        std::size_t count, Endianness endian)
+    {
+        std::size_t done = 0;
+        switch (ActiveSimdLevel())
+        {
+#if defined(BIN_DATA_X86_SIMD)
+        case SimdLevel::Avx2:
+            done = Pack24Avx2(source, destination, count, endian);
+            break;
+        case SimdLevel::Ssse3:
+            done = Pack24Ssse3(source, destination, count, endian);
+            break;
+#endif
+#if defined(BIN_DATA_NEON_SIMD)
+        case SimdLevel::Neon:
+            done = Pack24Neon(source, destination, count, endian);
+            break;
+#endif
+        default:
+            break;
+        }
+        Pack24Scalar(source + done, destination + done * 3, count - done, 
+            endian);
+    }
+}
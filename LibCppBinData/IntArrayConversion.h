@@ -0,0 +1,192 @@
+// IntArrayConversion.h - Declares the integer array conversion functions.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIN_DATA_INT_ARRAY_CONVERSION_H
+#define BIN_DATA_INT_ARRAY_CONVERSION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include "Endianness.h"
+
+namespace BinData
+{
+    // The functions below convert whole arrays of integers between the byte
+    // order of a file and the byte order of the host. Converting a table of
+    // samples or offsets one IntField at a time costs a call and a branch
+    // per value, whereas these convert 16 or 32 bytes at a time with the
+    // byte shuffle instructions of the host's vector unit.
+
+    /// @brief The vector instruction sets the array conversions can use.
+    enum class SimdLevel
+    {
+        Scalar,
+        Ssse3,
+        Avx2,
+        Neon
+    };
+
+    /// @brief Gets the best vector instruction set the host supports.
+    ///
+    /// The instruction set is detected once, at run time, so a single build
+    /// of the library makes use of whatever the host provides.
+    ///
+    /// @return The best instruction set supported by the host.
+    SimdLevel SupportedSimdLevel();
+
+    /// @brief Determines whether the host supports an instruction set.
+    /// @param level The instruction set to check for.
+    /// @return True if the array conversions can use the instruction set.
+    bool IsSimdLevelSupported(SimdLevel level);
+
+    /// @brief Gets the instruction set the array conversions currently use.
+    /// @return The instruction set in use, SupportedSimdLevel() by default.
+    SimdLevel ActiveSimdLevel();
+
+    /// @brief Sets the instruction set the array conversions use.
+    ///
+    /// This is mainly useful for testing and benchmarking the fallbacks.
+    ///
+    /// @param level The instruction set to use.
+    /// @return False, leaving the level unchanged, if the host does not
+    /// support the instruction set.
+    bool SetSimdLevel(SimdLevel level);
+
+    /// @brief Reverses the bytes of each 16-bit integer in an array.
+    /// @param source The integers to convert.
+    /// @param destination Where to store the converted integers, which may
+    /// be the same as source.
+    /// @param count The number of integers to convert.
+    void SwapBytes16(const char* source, char* destination, std::size_t count);
+
+    /// @brief Reverses the bytes of each 32-bit integer in an array.
+    /// @param source The integers to convert.
+    /// @param destination Where to store the converted integers, which may
+    /// be the same as source.
+    /// @param count The number of integers to convert.
+    void SwapBytes32(const char* source, char* destination, std::size_t count);
+
+    /// @brief Reverses the bytes of each 64-bit integer in an array.
+    /// @param source The integers to convert.
+    /// @param destination Where to store the converted integers, which may
+    /// be the same as source.
+    /// @param count The number of integers to convert.
+    void SwapBytes64(const char* source, char* destination, std::size_t count);
+
+    /// @brief Expands an array of 24-bit integers to native 32-bit integers.
+    /// @param source The packed 24-bit integers, 3 bytes each.
+    /// @param destination Where to store the 32-bit integers.
+    /// @param count The number of integers to convert.
+    /// @param endian The endianness of the 24-bit integers.
+    /// @param isSigned Whether to sign extend the integers.
+    void Expand24(const char* source, std::uint32_t* destination, 
+        std::size_t count, Endianness endian, bool isSigned);
+
+    /// @brief Packs native 32-bit integers into an array of 24-bit integers.
+    ///
+    /// The most significant byte of each 32-bit integer is discarded.
+    ///
+    /// @param source The 32-bit integers to convert.
+    /// @param destination Where to store the packed integers, 3 bytes each.
+    /// @param count The number of integers to convert.
+    /// @param endian The endianness to store the 24-bit integers in.
+    void Pack24(const std::uint32_t* source, char* destination, 
+        std::size_t count, Endianness endian);
+
+    /// @brief Swaps the bytes of an array of integers of the given size.
+    template<std::size_t size>
+    void SwapBytes(const char* source, char* destination, std::size_t count)
+    {
+        static_assert(size == 1 || size == 2 || size == 4 || size == 8,
+            "Only 8, 16, 32 and 64-bit integers can be swapped");
+        if constexpr (size == 1)
+            std::memmove(destination, source, count);
+        else if constexpr (size == 2)
+            SwapBytes16(source, destination, count);
+        else if constexpr (size == 4)
+            SwapBytes32(source, destination, count);
+        else
+            SwapBytes64(source, destination, count);
+    }
+
+    /// @brief Determines whether a native integer type can hold an array of
+    /// integers of the given size.
+    ///
+    /// The array conversions work on fixed width integers: the native type
+    /// must be exactly the size of the integers in the array, except for 24
+    /// bit integers, which are held in 32-bit types.
+    template<typename ValueType, std::size_t size>
+    constexpr bool isArrayIntType = std::is_integral_v<ValueType> && 
+        (size == 3 ? sizeof(ValueType) == 4 : sizeof(ValueType) == size) &&
+        (size == 1 || size == 2 || size == 3 || size == 4 || size == 8);
+
+    /// @brief Converts an array of raw integers to native integers.
+    /// @param data A pointer to count * size bytes of raw integer data.
+    /// @param values Where to store the count native integers.
+    /// @param count The number of integers to convert.
+    /// @param endian The endianness the raw data is stored in.
+    template<typename ValueType, std::size_t size>
+    void DecodeIntArray(const char* data, ValueType* values, 
+        std::size_t count, Endianness endian)
+    {
+        static_assert(isArrayIntType<ValueType, size>, 
+            "The value type does not match the integer size");
+        if constexpr (size == 3)
+        {
+            // Signed and unsigned integers of the same size may alias.
+            Expand24(data, reinterpret_cast<std::uint32_t*>(values), count, 
+                endian, std::is_signed_v<ValueType>);
+        }
+        else if (endian == hostEndianness || size == 1)
+        {
+            std::memcpy(values, data, count * size);
+        }
+        else
+        {
+            SwapBytes<size>(data, reinterpret_cast<char*>(values), count);
+        }
+    }
+
+    /// @brief Converts an array of native integers to raw integers.
+    /// @param data Where to store count * size bytes of raw integer data.
+    /// @param values The count native integers to convert.
+    /// @param count The number of integers to convert.
+    /// @param endian The endianness to store the raw data in.
+    template<typename ValueType, std::size_t size>
+    void EncodeIntArray(char* data, const ValueType* values, 
+        std::size_t count, Endianness endian)
+    {
+        static_assert(isArrayIntType<ValueType, size>, 
+            "The value type does not match the integer size");
+        if constexpr (size == 3)
+        {
+            Pack24(reinterpret_cast<const std::uint32_t*>(values), data, 
+                count, endian);
+        }
+        else if (endian == hostEndianness || size == 1)
+        {
+            std::memcpy(data, values, count * size);
+        }
+        else
+        {
+            SwapBytes<size>(reinterpret_cast<const char*>(values), data, 
+                count);
+        }
+    }
+}
+
+#endif
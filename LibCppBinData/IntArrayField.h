@@ -0,0 +1,170 @@
+// IntArrayField.h - Declares the IntArrayField class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIN_DATA_INT_ARRAY_FIELD_H
+#define BIN_DATA_INT_ARRAY_FIELD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <iostream>
+#include "IntFieldBase.h"
+#include "Endianness.h"
+#include "IntConversion.h"
+#include "IntArrayConversion.h"
+
+namespace BinData
+{
+    /// @brief A field that holds an array of integers of the same size.
+    ///
+    /// Tables of samples, offsets or sizes are read into a single field
+    /// rather than one IntField per entry, and converted to native integers
+    /// in one call to Values(), which uses the host's vector instructions.
+    ///
+    /// @tparam ValueType The fixed width integer type values are read as,
+    /// which must be exactly size bytes, or 4 bytes for 24-bit integers.
+    /// @tparam size The size of each integer in the array, in bytes.
+    template<typename ValueType, std::size_t size>
+    class IntArrayField 
+        : public IntFieldBase<IntArrayField<ValueType, size>>
+    {
+    public:
+        static_assert(isArrayIntType<ValueType, size>, 
+            "The value type does not match the integer size");
+
+        /// @brief Constructs a new IntArrayField.
+        /// @param count The number of integers in the array.
+        /// @param endian The endianness the integers are stored in.
+        /// @pre The count must be at least one.
+        IntArrayField(std::size_t count, Endianness endian = Endianness::Little)
+            : endian{ endian }
+        {
+            if (count == 0)
+                throw InvalidField{ fieldSizeError };
+            data.resize(count * size);
+        }
+
+        Endianness Endian() const
+        {
+            return endian;
+        }
+
+        /// @brief Gets the number of integers in the array.
+        std::size_t Count() const
+        {
+            return data.size() / size;
+        }
+
+        /// @brief Gets the size of the field, in bytes.
+        /// @return The size of the field, in bytes.
+        std::size_t Size() const override
+        {
+            return data.size();
+        }
+
+        /// @brief Gets the value of a single integer in the array.
+        /// @param index The index of the integer.
+        /// @return The value of the integer as a native integer type.
+        ValueType Value(std::size_t index) const
+        {
+            return DecodeInt<ValueType, size>(data.data() + index * size, 
+                endian);
+        }
+
+        /// @brief Converts every integer in the array to a native integer.
+        /// @param values Where to store Count() native integers.
+        void Values(ValueType* values) const
+        {
+            DecodeIntArray<ValueType, size>(data.data(), values, Count(), 
+                endian);
+        }
+
+        /// @brief Converts every integer in the array to a native integer.
+        /// @return The values of the integers as native integers.
+        std::vector<ValueType> Values() const
+        {
+            std::vector<ValueType> values(Count());
+            Values(values.data());
+            return values;
+        }
+
+        /// @brief Gets a raw pointer to the underlying data.
+        ///
+        /// This interface is intended for use with legacy APIs that need to
+        /// work with the raw data. The delete[] instruction should not be 
+        /// called on this pointer, nor should it be dereferenced once the
+        /// IntArrayField has been destroyed or goes out of scope.
+        ///
+        /// @return The raw pointer to the underlying data.
+        char* Data() override
+        {
+            return data.data();
+        }
+
+        /// @brief Prints the values as space separated decimal integers.
+        /// @param os The stream to print the values to.
+        void Print(std::ostream& os) const
+        {
+            std::vector<ValueType> values = Values();
+            for (std::size_t i = 0; i < values.size(); i++)
+            {
+                if (i > 0)
+                    os << " ";
+
+                // Print 8-bit integers as numbers rather than characters.
+                os << +values[i];
+            }
+        }
+
+        void SetEndian(Endianness endian)
+        {
+            this->endian = endian;
+        }
+
+        /// @brief Sets a single integer in the array.
+        /// @param index The index of the integer.
+        /// @param v The value to set the integer to.
+        void SetValue(std::size_t index, ValueType v)
+        {
+            EncodeInt<ValueType, size>(data.data() + index * size, v, endian);
+        }
+
+        /// @brief Sets every integer in the array.
+        /// @param values Count() native integers to store in the array.
+        void SetValues(const ValueType* values)
+        {
+            EncodeIntArray<ValueType, size>(data.data(), values, Count(), 
+                endian);
+        }
+    private:
+        std::vector<char> data;
+        Endianness endian;
+    };
+
+    using UInt8ArrayField = IntArrayField<std::uint8_t, 1>;
+    using UInt16ArrayField = IntArrayField<std::uint16_t, 2>;
+    using UInt24ArrayField = IntArrayField<std::uint32_t, 3>;
+    using UInt32ArrayField = IntArrayField<std::uint32_t, 4>;
+    using UInt64ArrayField = IntArrayField<std::uint64_t, 8>;
+
+    using Int8ArrayField = IntArrayField<std::int8_t, 1>;
+    using Int16ArrayField = IntArrayField<std::int16_t, 2>;
+    using Int24ArrayField = IntArrayField<std::int32_t, 3>;
+    using Int32ArrayField = IntArrayField<std::int32_t, 4>;
+    using Int64ArrayField = IntArrayField<std::int64_t, 8>;
+}
+
+#endif
@@ -0,0 +1,540 @@
+// IntConversion.h - Declares the integer conversion functions.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissionsand
+// limitations under the License.
+
+#ifndef BIN_DATA_INT_CONVERSION_H
+#define BIN_DATA_INT_CONVERSION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include "IntConstants.h"
+#include "Endianness.h"
+
+namespace BinData
+{
+    // The functions below convert between the raw bytes of an integer field
+    // and a native integer type. They operate on a raw pointer rather than a
+    // field so that both owning fields (IntField) and non-owning views
+    // (IntFieldView) can share the exact same conversion code.
+    //
+    // The byte-by-byte functions assemble values with shifts, which operate
+    // on values rather than memory, so despite their names they give the
+    // same results on big endian hosts. Only the memcpy based fast paths
+    // depend on the host's byte order, which is resolved at compile time
+    // through hostEndianness.
+
+    // Call this function when the system's integers are litte endian.
+    template<std::size_t size>
+    unsigned long long GetSignBitPaddingLE()
+    {
+        unsigned long long resultPadding = 0;
+
+        // We need to know how big the result size is to know how
+        // many extra bytes we need to set to the padding value of 
+        // 0xFF. Although it should be at least 64-bits per the 
+        // standard, it may be 128-bits on some platforms.
+        std::size_t resultSize = sizeof(unsigned long long);
+
+        // The first 0xFF will need to be shifted into the most 
+        // significant byte, which is n-1 bytes to shift.
+        unsigned int bytesToShift = resultSize - 1;
+
+        // Start at the result size but decrease until we're at the
+        // same size as the IntField so we know when to stop padding
+        // the result with 0xFF.
+        for (std::size_t i = resultSize; i > size; i--)
+        {
+            unsigned int bitsToShift = bytesToShift * bitsPerByte;
+
+            // Even though we're just shifting a single byte value into
+            // place, we store the padding value straight into an
+            // unsigned long long so it is exactly the same size as 
+            // result with no risk of accidental sign conversion, etc.
+            // Esentially looks like this if long long is 64-bit little
+            // endian:
+            // FF 00 00 00 00 00 00 00 
+            unsigned long long padding{ 0xFF };
+
+            // Assuming 64-bit little endian, if padding was shifted on
+            // the first pass:  00 00 00 00 00 00 00 FF
+            // second pass:     00 00 00 00 00 00 FF 00, etc.
+            padding = padding << bitsToShift;
+
+            // Bitwise or the padding with the result to combine each 
+            // pass of the padding byte shift into the result:
+            // result on first pass:  00 00 00 00 00 00 00 FF
+            // result on second pass: 00 00 00 00 00 00 FF FF, etc.
+            resultPadding = resultPadding | padding;
+
+            bytesToShift--;
+        }
+
+        return resultPadding;
+    }
+
+    // Call this function when the data is stored in little endian format
+    // and the system has little endian integers . 
+    template<typename ValueType, std::size_t size>
+    ValueType ValueLEToLE(const char* data)
+    {
+        // To convert raw bytes to native integer types, we will use
+        // bit shifts and bitwise or on each byte to get it into the
+        // result integer while not circumventing the type system or
+        // having to guess what type of integer to use. While loading the
+        // individual bytes into the long long result integer, we want to
+        // keep everything unsigned so there are no unexpected sign 
+        // conversions / overflows. We use the largest available integer
+        // type so we can handle all possible result sizes with the same 
+        // code.
+        unsigned long long result = 0;
+
+        // We have to do some extra work if this IntField is signed and
+        // the value is negative: if the field size is less than the
+        // result size (likely true for all field sizes less than 
+        // Int64Field), we need to set the unused most significant bytes 
+        // to 0xFF to ensure the result is interpreted as 2's compliment.
+        bool signBitSet = (data[size - 1] & signBitMask) == signBitMask;
+        if (std::numeric_limits<ValueType>::is_signed && signBitSet)
+            result = GetSignBitPaddingLE<size>();
+
+        for (std::size_t i = 0; i < size; i++)
+        {
+            // We are assuming the raw data is little endian so we start with
+            // no byte shifts at first when i = 0, but then we'll shift the 
+            // next byte one position (i = 1), etc.
+            unsigned int bitsToShift = i * bitsPerByte;
+
+            // Convert the byte to unsigned to avoid any implicit sign
+            // conversion.
+            unsigned char currentByte = static_cast<unsigned char>(
+                data[i]);
+
+            // Copy the currentByte into another unsigned long long to 
+            // match result so they can be bitwise or'd together without
+            // any accidental promotion, sign conversion, etc.
+            unsigned long long valueToShift = currentByte;
+
+            unsigned long long shiftedValue = valueToShift << bitsToShift;
+
+            // Bitwise or the shifted value with the result to combine the 
+            // shifted bits with the existing result. To use an example, if
+            // we were converting the little endian representation of 
+            // 42,000,000, which would be:
+            //
+            // Hex: 0x80 0xDE 0x80 0x02
+            // Bin: 10000000 11011110 10000000 00000010
+            //
+            // Each iteration would do the following:
+            //
+            // First iteration:
+            // result        : 00000000 00000000 00000000 00000000
+            // | shiftedByte : 10000000 00000000 00000000 00000000
+            //                 -----------------------------------
+            // result        : 10000000 00000000 00000000 00000000
+            //
+            // Second iteration:
+            // result        : 10000000 00000000 00000000 00000000
+            // | shiftedByte : 00000000 11011110 00000000 00000000
+            //                 -----------------------------------
+            // result        : 10000000 11011110 00000000 00000000
+            //
+            // Third iteration:
+            // result        : 10000000 11011110 00000000 00000000
+            // | shiftedByte : 00000000 00000000 10000000 00000000
+            //                 -----------------------------------
+            // result        : 10000000 11011110 10000000 00000000
+            //
+            // Fourth iteration:
+            // result        : 10000000 11011110 10000000 00000000
+            // | shiftedByte : 00000000 00000000 00000000 00000010
+            //                 -----------------------------------
+            // result        : 10000000 11011110 10000000 00000010
+            result = result | shiftedValue;
+        }
+
+        // After the unsigned bits have been transferred to the result 
+        // integer, we can finally convert the result to whatever the
+        // IntField's ValueType is, signed or unsigned, without losing
+        // information.
+        return static_cast<ValueType>(result);
+    }
+
+    // Call this function when the data is stored in big endian format
+    // but the system has little endian integers.
+    template<typename ValueType, std::size_t size>
+    ValueType ValueBEToLE(const char* data)
+    {
+        // To convert raw bytes to native integer types, we will use
+        // bit shifts and bitwise or on each byte to get it into the
+        // result integer while not circumventing the type system or
+        // having to guess what type of integer to use. While loading the
+        // individual bytes into the long long result integer, we want to
+        // keep everything unsigned so there are no unexpected sign 
+        // conversions / overflows. We use the largest available integer
+        // type so we can handle all possible result sizes with the same 
+        // code.
+        unsigned long long result = 0;
+
+        // We have to do some extra work if this IntField is signed and
+        // the value is negative: if the field size is less than the
+        // result size (likely true for all field sizes less than 
+        // Int64Field), we need to set the unused most significant bytes 
+        // to 0xFF to ensure the result is interpreted as 2's compliment.
+        bool signBitSet = (data[0] & signBitMask) == signBitMask;
+        if (std::numeric_limits<ValueType>::is_signed && signBitSet)
+            result = GetSignBitPaddingLE<size>();
+        
+        int bytesToShift = size - 1;
+        for (std::size_t i = 0; i < size; i++)
+        {
+            unsigned int bitsToShift = bytesToShift * bitsPerByte;
+
+            // Convert the byte to unsigned to avoid any implicit sign
+            // conversion.
+            unsigned char currentByte = static_cast<unsigned char>(
+                data[i]);
+
+            // Copy the currentByte into another unsigned long long to 
+            // match result so they can be bitwise or'd together without
+            // any accidental promotion, sign conversion, etc.
+            unsigned long long valueToShift = currentByte;
+
+            unsigned long long shiftedValue = valueToShift << bitsToShift;
+
+            // Bitwise or the shifted value with the result to combine the 
+            // shifted bits with the existing result. To use an example, if
+            // we were converting the big endian representation of 
+            // 42,000,000, which would be:
+            //
+            // Hex: 0x02 0x80 0xDE 0x80
+            // Bin: 00000010 10000000 11011110 10000000
+            //
+            // Each iteration would do the following:
+            //
+            // First iteration:
+            // result        : 00000000 00000000 00000000 00000000
+            // | shiftedByte : 00000000 00000000 00000000 00000010
+            //                 -----------------------------------
+            // result        : 00000000 00000000 00000000 00000010
+            //
+            // Second iteration:
+            // result        : 00000000 00000000 00000000 00000010
+            // | shiftedByte : 00000000 00000000 10000000 00000000
+            //                 -----------------------------------
+            // result        : 00000000 00000000 10000000 00000010
+            //
+            // Third iteration:
+            // result        : 00000000 00000000 10000000 00000010
+            // | shiftedByte : 00000000 11011110 00000000 00000000
+            //                 -----------------------------------
+            // result        : 00000000 11011110 10000000 00000010
+            //
+            // Fourth iteration:
+            // result        : 00000000 11011110 10000000 00000010
+            // | shiftedByte : 10000000 00000000 00000000 00000000
+            //                 -----------------------------------
+            // result        : 10000000 11011110 10000000 00000010
+            result = result | shiftedValue;
+
+            bytesToShift--;
+        }
+
+        // After the unsigned bits have been transferred to the result 
+        // integer, we can finally convert the result to whatever the
+        // IntField's ValueType is, signed or unsigned, without losing
+        // information.
+        return static_cast<ValueType>(result);
+    }
+
+    template<typename ValueType, std::size_t size>
+    void SetValueLEToLE(char* data, ValueType v)
+    {
+        constexpr unsigned long long bitMask{ 0xFF };
+        auto value = static_cast<unsigned long long>(v);
+        for (std::size_t i = 0; i < size; i++)
+        {
+            unsigned int bitsToShift = i * bitsPerByte;
+            unsigned long long shiftedBitMask = bitMask << bitsToShift;
+            unsigned long long byte = value & shiftedBitMask;
+            unsigned long long shiftedByte = byte >> bitsToShift;
+            data[i] = static_cast<char>(shiftedByte);
+        }
+    }
+
+    template<typename ValueType, std::size_t size>
+    void SetValueLEToBE(char* data, ValueType v)
+    {
+        constexpr unsigned long long bitMask{ 0xFF };
+        auto value = static_cast<unsigned long long>(v);
+        unsigned int bytesToShift = size - 1;
+        for (std::size_t i = 0; i < size; i++)
+        {
+            unsigned int bitsToShift = bytesToShift * bitsPerByte;
+            unsigned long long shiftedBitMask = bitMask << bitsToShift;
+            unsigned long long byte = value & shiftedBitMask;
+            unsigned long long shiftedByte = byte >> bitsToShift;
+            data[i] = static_cast<char>(shiftedByte);
+            bytesToShift--;
+        }
+    }
+
+    // The byte-by-byte functions above work for an integer of any size, but
+    // the fields almost always hold 1, 2, 3, 4 or 8 byte integers. For those
+    // sizes the functions below load the whole integer with a single memcpy,
+    // which compilers turn into one (possibly unaligned) load, and reverse
+    // its bytes with a single byte swap instruction when required.
+
+    /// @brief Determines whether an integer size has a dedicated fast path.
+    template<std::size_t size>
+    constexpr bool hasFastIntPath = size == 1 || size == 2 || size == 3 || 
+        size == 4 || size == 8;
+
+    /// @brief The unsigned integer type used to load a field of a given size.
+    ///
+    /// A 3 byte field is loaded into a 32-bit integer.
+    template<std::size_t size>
+    using FastUInt = std::conditional_t<size == 1, std::uint8_t,
+        std::conditional_t<size == 2, std::uint16_t,
+        std::conditional_t<size <= 4, std::uint32_t, std::uint64_t>>>;
+
+    inline std::uint8_t ByteSwap(std::uint8_t v)
+    {
+        return v;
+    }
+
+    inline std::uint16_t ByteSwap(std::uint16_t v)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_bswap16(v);
+#else
+        return static_cast<std::uint16_t>((v >> 8) | (v << 8));
+#endif
+    }
+
+    inline std::uint32_t ByteSwap(std::uint32_t v)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_bswap32(v);
+#else
+        return (v >> 24) | ((v >> 8) & 0xFF00) | ((v << 8) & 0xFF0000) | 
+            (v << 24);
+#endif
+    }
+
+    inline std::uint64_t ByteSwap(std::uint64_t v)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_bswap64(v);
+#else
+        return (static_cast<std::uint64_t>(ByteSwap(
+            static_cast<std::uint32_t>(v))) << 32) | 
+            ByteSwap(static_cast<std::uint32_t>(v >> 32));
+#endif
+    }
+
+    // Loads the bytes of a field in the host's byte order, then swaps them
+    // if the data is stored in the other one. Because the host's byte order
+    // is known at compile time, the load compiles down to a single load
+    // with at most one byte swap instruction.
+    template<std::size_t size, Endianness endian>
+    FastUInt<size> Load(const char* data)
+    {
+        FastUInt<size> raw;
+        std::memcpy(&raw, data, size);
+        if constexpr (endian != hostEndianness)
+            return ByteSwap(raw);
+        else
+            return raw;
+    }
+
+    template<std::size_t size, Endianness endian>
+    void Store(char* data, FastUInt<size> raw)
+    {
+        if constexpr (endian != hostEndianness)
+            raw = ByteSwap(raw);
+        std::memcpy(data, &raw, size);
+    }
+
+    // Loads the bytes of a field so that the first byte in memory ends up as
+    // the least significant byte of the result.
+    template<std::size_t size>
+    FastUInt<size> LoadLE(const char* data)
+    {
+        if constexpr (size == 3)
+        {
+            auto bytes = reinterpret_cast<const unsigned char*>(data);
+            return static_cast<std::uint32_t>(bytes[0]) | 
+                static_cast<std::uint32_t>(bytes[1]) << 8 | 
+                static_cast<std::uint32_t>(bytes[2]) << 16;
+        }
+        else
+        {
+            return Load<size, Endianness::Little>(data);
+        }
+    }
+
+    // Loads the bytes of a field so that the first byte in memory ends up as
+    // the most significant byte of the result.
+    template<std::size_t size>
+    FastUInt<size> LoadBE(const char* data)
+    {
+        if constexpr (size == 3)
+        {
+            auto bytes = reinterpret_cast<const unsigned char*>(data);
+            return static_cast<std::uint32_t>(bytes[0]) << 16 | 
+                static_cast<std::uint32_t>(bytes[1]) << 8 | 
+                static_cast<std::uint32_t>(bytes[2]);
+        }
+        else
+        {
+            return Load<size, Endianness::Big>(data);
+        }
+    }
+
+    template<std::size_t size>
+    void StoreLE(char* data, FastUInt<size> raw)
+    {
+        if constexpr (size == 3)
+        {
+            data[0] = static_cast<char>(raw);
+            data[1] = static_cast<char>(raw >> 8);
+            data[2] = static_cast<char>(raw >> 16);
+        }
+        else
+        {
+            Store<size, Endianness::Little>(data, raw);
+        }
+    }
+
+    template<std::size_t size>
+    void StoreBE(char* data, FastUInt<size> raw)
+    {
+        if constexpr (size == 3)
+        {
+            data[0] = static_cast<char>(raw >> 16);
+            data[1] = static_cast<char>(raw >> 8);
+            data[2] = static_cast<char>(raw);
+        }
+        else
+        {
+            Store<size, Endianness::Big>(data, raw);
+        }
+    }
+
+    // Converts the loaded bits of a field to its ValueType. Signed values
+    // are sign extended by shifting the field's sign bit into the most 
+    // significant bit of a signed 64-bit integer and shifting it back down
+    // arithmetically, which replaces the padding loop of the byte-by-byte 
+    // conversion.
+    template<typename ValueType, std::size_t size>
+    ValueType ExtendInt(FastUInt<size> raw)
+    {
+        if constexpr (std::numeric_limits<ValueType>::is_signed && size < 8)
+        {
+            constexpr unsigned int unusedBits = (8 - size) * bitsPerByte;
+            auto shifted = static_cast<std::int64_t>(
+                static_cast<std::uint64_t>(raw) << unusedBits);
+            return static_cast<ValueType>(shifted >> unusedBits);
+        }
+        else
+        {
+            return static_cast<ValueType>(raw);
+        }
+    }
+
+    /// @brief Converts raw integer bytes of a fixed endianness to a native
+    /// integer type.
+    ///
+    /// Unlike the overload taking the endianness as an argument, the byte
+    /// order is resolved at compile time, so no branch is left in the
+    /// generated code.
+    ///
+    /// @param data A pointer to size bytes of raw integer data.
+    /// @return The value of the data as a native integer type.
+    template<typename ValueType, std::size_t size, Endianness endian>
+    ValueType DecodeInt(const char* data)
+    {
+        if constexpr (!hasFastIntPath<size>)
+        {
+            if constexpr (endian == Endianness::Little)
+                return ValueLEToLE<ValueType, size>(data);
+            else
+                return ValueBEToLE<ValueType, size>(data);
+        }
+        else if constexpr (endian == Endianness::Little)
+        {
+            return ExtendInt<ValueType, size>(LoadLE<size>(data));
+        }
+        else
+        {
+            return ExtendInt<ValueType, size>(LoadBE<size>(data));
+        }
+    }
+
+    /// @brief Converts a native integer type to raw integer bytes of a fixed
+    /// endianness.
+    /// @param data A pointer to size bytes to store the raw data in.
+    /// @param v The value to convert.
+    template<typename ValueType, std::size_t size, Endianness endian>
+    void EncodeInt(char* data, ValueType v)
+    {
+        if constexpr (!hasFastIntPath<size>)
+        {
+            if constexpr (endian == Endianness::Little)
+                SetValueLEToLE<ValueType, size>(data, v);
+            else
+                SetValueLEToBE<ValueType, size>(data, v);
+        }
+        else if constexpr (endian == Endianness::Little)
+        {
+            StoreLE<size>(data, static_cast<FastUInt<size>>(v));
+        }
+        else
+        {
+            StoreBE<size>(data, static_cast<FastUInt<size>>(v));
+        }
+    }
+
+    /// @brief Converts raw integer bytes to a native integer type.
+    /// @param data A pointer to size bytes of raw integer data.
+    /// @param endian The endianness the raw data is stored in.
+    /// @return The value of the data as a native integer type.
+    template<typename ValueType, std::size_t size>
+    ValueType DecodeInt(const char* data, Endianness endian)
+    {
+        if (endian == Endianness::Little)
+            return DecodeInt<ValueType, size, Endianness::Little>(data);
+        else
+            return DecodeInt<ValueType, size, Endianness::Big>(data);
+    }
+
+    /// @brief Converts a native integer type to raw integer bytes.
+    /// @param data A pointer to size bytes to store the raw data in.
+    /// @param v The value to convert.
+    /// @param endian The endianness to store the raw data in.
+    template<typename ValueType, std::size_t size>
+    void EncodeInt(char* data, ValueType v, Endianness endian)
+    {
+        if (endian == Endianness::Little)
+            EncodeInt<ValueType, size, Endianness::Little>(data, v);
+        else
+            EncodeInt<ValueType, size, Endianness::Big>(data, v);
+    }
+}
+
+#endif
@@ -27,6 +27,7 @@
 #include "Format.h"
 #include "IntConstants.h"
 #include "Endianness.h"
+#include "IntConversion.h"
 
 namespace BinData
 {   
@@ -100,27 +101,16 @@ namespace BinData
         /// @brief Gets the value of the data as a native integer type.
         ///
         /// This function reads the raw bytes representing an integer
-        /// value into a native integer type. It interprets the value as if it
-        /// were the same endianness as the current system. If the data in the
-        /// field is the opposite of the current system's endianess, then use
-        /// ValueOtherEndian().
+        /// value into a native integer type. The bytes are interpreted in the
+        /// field's endianness, and are only swapped when that differs from
+        /// the endianness of the current system.
         ///
         /// @return The value of the data as a native integer type.
         ValueType Value() const
         {
             if (data == nullptr)
                 throw InvalidField{ nullFieldError };
-            if (endian == Endianness::Little)
-                return ValueLEToLE();
-            else
-                return ValueBEToLE();
-
-            // TODO: On big endian systems, disable the above code and enable
-            // the code below:
-            // if (mEndianness == BinData::Endianness::Big)
-            //     return ValueBEToBE();
-            // else
-            //     return ValueLEToBE();
+            return DecodeInt<ValueType, size>(data.get(), endian);
         }
 
         /// @brief Gets a string representation in the default format.
@@ -177,22 +167,6 @@ namespace BinData
             return data.get();
         }
 
-        /*
-        /// @brief Gets the value of the data as a native integer type.
-        ///
-        /// Use this variation of the Value() method when the data in the field
-        /// is the opposite endianness of the current system.
-        ///
-        /// @return The value of the data as a native integer type.
-        ValueType ValueOppositeEndianness() const
-        {
-            // If platform is little endian
-            return ValueBEToLE();
-
-            // TODO: Else if platform is big endian
-            //return ValueLEToBE();
-        }*/
-
         void SetEndian(Endianness endian)
         {
             this->endian = endian;
@@ -201,299 +175,24 @@ namespace BinData
         /// @brief Sets the field to the value of the specified integer.
         ///
         /// The specified integer value is stored as raw bytes in the
-        /// data field with the same endianness of the current system.
-        /// If the data should be set in the opposite endianness, use
-        /// SetValueOtherEndian().
+        /// data field in the field's endianness, regardless of the 
+        /// endianness of the current system.
         ///
         /// @param v The value to set the field to.
         void SetValue(ValueType v)
         {
             if (data != nullptr)
-            {
-                if (endian == Endianness::Little)
-                    SetValueLEToLE(v);
-                else
-                    SetValueLEToBE(v);
-            }
+                EncodeInt<ValueType, size>(data.get(), v, endian);
             else
                 throw InvalidField{ nullFieldError };
-
-            // TODO: On big endian systems, disable the above code and enable
-            // the code below:
-            // if (mEndianness == BinData::Endianness::Big)
-            //     SetValueBEToBE(v);
-            // else
-            //     SetValueBEToLE(v);
         }
 
-        /*
-        /// @brief Sets the field to the value of the specified integer.
-        ///
-        /// Use this variation of the SetValue() method when the data in the
-        /// field needs to be stored in the opposite endianness of the current
-        /// system.
-        ///
-        /// @param v The value to set the field to.
-        void SetValueOppositeEndianness(ValueType v)
-        {
-            SetValueLEToBE(v);
-        }*/
     //protected:
     //    Format defaultFormat;
     private:
         std::unique_ptr<char[]> data;
         Endianness endian;
 
-        // Call this function when the data is stored in little endian format
-        // and the system has little endian integers . 
-        ValueType ValueLEToLE() const
-        {
-            // To convert raw bytes to native integer types, we will use
-            // bit shifts and bitwise or on each byte to get it into the
-            // result integer while not circumventing the type system or
-            // having to guess what type of integer to use. While loading the
-            // individual bytes into the long long result integer, we want to
-            // keep everything unsigned so there are no unexpected sign 
-            // conversions / overflows. We use the largest available integer
-            // type so we can handle all possible result sizes with the same 
-            // code.
-            unsigned long long result = 0;
-
-            // We have to do some extra work if this IntField is signed and
-            // the value is negative: if the field size is less than the
-            // result size (likely true for all field sizes less than 
-            // Int64Field), we need to set the unused most significant bytes 
-            // to 0xFF to ensure the result is interpreted as 2's compliment.
-            bool signBitSet = (data[size - 1] & signBitMask) == signBitMask;
-            if (std::numeric_limits<ValueType>::is_signed && signBitSet)
-                result = GetSignBitPaddingLE();
-    
-            for (int i = 0; i < size; i++)
-            {
-                // We are assuming the raw data is little endian so we start with
-                // no byte shifts at first when i = 0, but then we'll shift the 
-                // next byte one position (i = 1), etc.
-                unsigned int bitsToShift = i * bitsPerByte;
-
-                // Convert the byte to unsigned to avoid any implicit sign
-                // conversion.
-                unsigned char currentByte = static_cast<unsigned char>(
-                    data[i]);
-
-                // Copy the currentByte into another unsigned long long to 
-                // match result so they can be bitwise or'd together without
-                // any accidental promotion, sign conversion, etc.
-                unsigned long long valueToShift = currentByte;
-
-                unsigned long long shiftedValue = valueToShift << bitsToShift;
-
-                // Bitwise or the shifted value with the result to combine the 
-                // shifted bits with the existing result. To use an example, if
-                // we were converting the little endian representation of 
-                // 42,000,000, which would be:
-                //
-                // Hex: 0x80 0xDE 0x80 0x02
-                // Bin: 10000000 11011110 10000000 00000010
-                //
-                // Each iteration would do the following:
-                //
-                // First iteration:
-                // result        : 00000000 00000000 00000000 00000000
-                // | shiftedByte : 10000000 00000000 00000000 00000000
-                //                 -----------------------------------
-                // result        : 10000000 00000000 00000000 00000000
-                //
-                // Second iteration:
-                // result        : 10000000 00000000 00000000 00000000
-                // | shiftedByte : 00000000 11011110 00000000 00000000
-                //                 -----------------------------------
-                // result        : 10000000 11011110 00000000 00000000
-                //
-                // Third iteration:
-                // result        : 10000000 11011110 00000000 00000000
-                // | shiftedByte : 00000000 00000000 10000000 00000000
-                //                 -----------------------------------
-                // result        : 10000000 11011110 10000000 00000000
-                //
-                // Fourth iteration:
-                // result        : 10000000 11011110 10000000 00000000
-                // | shiftedByte : 00000000 00000000 00000000 00000010
-                //                 -----------------------------------
-                // result        : 10000000 11011110 10000000 00000010
-                result = result | shiftedValue;
-            }
-
-            // After the unsigned bits have been transferred to the result 
-            // integer, we can finally convert the result to whatever the
-            // IntField's ValueType is, signed or unsigned, without losing
-            // information.
-            return static_cast<ValueType>(result);
-        }
-
-        // Call this function when the data is stored in big endian format
-        // but the system has little endian integers.
-        ValueType ValueBEToLE() const
-        {
-            // To convert raw bytes to native integer types, we will use
-            // bit shifts and bitwise or on each byte to get it into the
-            // result integer while not circumventing the type system or
-            // having to guess what type of integer to use. While loading the
-            // individual bytes into the long long result integer, we want to
-            // keep everything unsigned so there are no unexpected sign 
-            // conversions / overflows. We use the largest available integer
-            // type so we can handle all possible result sizes with the same 
-            // code.
-            unsigned long long result = 0;
-
-            // We have to do some extra work if this IntField is signed and
-            // the value is negative: if the field size is less than the
-            // result size (likely true for all field sizes less than 
-            // Int64Field), we need to set the unused most significant bytes 
-            // to 0xFF to ensure the result is interpreted as 2's compliment.
-            bool signBitSet = (data[0] & signBitMask) == signBitMask;
-            if (std::numeric_limits<ValueType>::is_signed && signBitSet)
-                result = GetSignBitPaddingLE();
-            
-            int bytesToShift = size - 1;
-            for (int i = 0; i < size; i++)
-            {
-                unsigned int bitsToShift = bytesToShift * bitsPerByte;
-
-                // Convert the byte to unsigned to avoid any implicit sign
-                // conversion.
-                unsigned char currentByte = static_cast<unsigned char>(
-                    data[i]);
-
-                // Copy the currentByte into another unsigned long long to 
-                // match result so they can be bitwise or'd together without
-                // any accidental promotion, sign conversion, etc.
-                unsigned long long valueToShift = currentByte;
-
-                unsigned long long shiftedValue = valueToShift << bitsToShift;
-
-                // Bitwise or the shifted value with the result to combine the 
-                // shifted bits with the existing result. To use an example, if
-                // we were converting the big endian representation of 
-                // 42,000,000, which would be:
-                //
-                // Hex: 0x02 0x80 0xDE 0x80
-                // Bin: 00000010 10000000 11011110 10000000
-                //
-                // Each iteration would do the following:
-                //
-                // First iteration:
-                // result        : 00000000 00000000 00000000 00000000
-                // | shiftedByte : 00000000 00000000 00000000 00000010
-                //                 -----------------------------------
-                // result        : 00000000 00000000 00000000 00000010
-                //
-                // Second iteration:
-                // result        : 00000000 00000000 00000000 00000010
-                // | shiftedByte : 00000000 00000000 10000000 00000000
-                //                 -----------------------------------
-                // result        : 00000000 00000000 10000000 00000010
-                //
-                // Third iteration:
-                // result        : 00000000 00000000 10000000 00000010
-                // | shiftedByte : 00000000 11011110 00000000 00000000
-                //                 -----------------------------------
-                // result        : 00000000 11011110 10000000 00000010
-                //
-                // Fourth iteration:
-                // result        : 00000000 11011110 10000000 00000010
-                // | shiftedByte : 10000000 00000000 00000000 00000000
-                //                 -----------------------------------
-                // result        : 10000000 11011110 10000000 00000010
-                result = result | shiftedValue;
-
-                bytesToShift--;
-            }
-
-            // After the unsigned bits have been transferred to the result 
-            // integer, we can finally convert the result to whatever the
-            // IntField's ValueType is, signed or unsigned, without losing
-            // information.
-            return static_cast<ValueType>(result);
-        }
-
-        // Call this function when the system's integers are litte endian.
-        unsigned long long GetSignBitPaddingLE() const
-        {
-            unsigned long long resultPadding = 0;
-
-            // We need to know how big the result size is to know how
-            // many extra bytes we need to set to the padding value of 
-            // 0xFF. Although it should be at least 64-bits per the 
-            // standard, it may be 128-bits on some platforms.
-            int resultSize = sizeof(unsigned long long);
-
-            // The first 0xFF will need to be shifted into the most 
-            // significant byte, which is n-1 bytes to shift.
-            unsigned int bytesToShift = resultSize - 1;
-
-            // Start at the result size but decrease until we're at the
-            // same size as the IntField so we know when to stop padding
-            // the result with 0xFF.
-            for (int i = resultSize; i > size; i--)
-            {
-                unsigned int bitsToShift = bytesToShift * bitsPerByte;
-
-                // Even though we're just shifting a single byte value into
-                // place, we store the padding value straight into an
-                // unsigned long long so it is exactly the same size as 
-                // result with no risk of accidental sign conversion, etc.
-                // Esentially looks like this if long long is 64-bit little
-                // endian:
-                // FF 00 00 00 00 00 00 00 
-                unsigned long long padding{ 0xFF };
-
-                // Assuming 64-bit little endian, if padding was shifted on
-                // the first pass:  00 00 00 00 00 00 00 FF
-                // second pass:     00 00 00 00 00 00 FF 00, etc.
-                padding = padding << bitsToShift;
-
-                // Bitwise or the padding with the result to combine each 
-                // pass of the padding byte shift into the result:
-                // result on first pass:  00 00 00 00 00 00 00 FF
-                // result on second pass: 00 00 00 00 00 00 FF FF, etc.
-                resultPadding = resultPadding | padding;
-
-                bytesToShift--;
-            }
-
-            return resultPadding;
-        }
-
-        void SetValueLEToLE(ValueType v)
-        {
-            constexpr unsigned long long bitMask{ 0xFF };
-            auto value = static_cast<unsigned long long>(v);
-            for (int i = 0; i < size; i++)
-            {
-                unsigned int bitsToShift = i * bitsPerByte;
-                unsigned long long shiftedBitMask = bitMask << bitsToShift;
-                unsigned long long byte = value & shiftedBitMask;
-                unsigned long long shiftedByte = byte >> bitsToShift;
-                data[i] = static_cast<char>(shiftedByte);
-            }
-        }
-
-        void SetValueLEToBE(ValueType v)
-        {
-            constexpr unsigned long long bitMask{ 0xFF };
-            auto value = static_cast<unsigned long long>(v);
-            unsigned int bytesToShift = size - 1;
-            for (int i = 0; i < size; i++)
-            {
-                unsigned int bitsToShift = bytesToShift * bitsPerByte;
-                unsigned long long shiftedBitMask = bitMask << bitsToShift;
-                unsigned long long byte = value & shiftedBitMask;
-                unsigned long long shiftedByte = byte >> bitsToShift;
-                data[i] = static_cast<char>(shiftedByte);
-                bytesToShift--;
-            }
-        }
-
         friend std::ostream& operator<< <>(std::ostream& os, const IntField<ValueType, size>& f);
     };
 
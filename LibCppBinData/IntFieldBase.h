@@ -0,0 +1,90 @@
+// IntFieldBase.h - Declares the IntFieldBase class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIN_DATA_INT_FIELD_BASE_H
+#define BIN_DATA_INT_FIELD_BASE_H
+
+#include <string>
+#include <sstream>
+#include <iostream>
+#include "Field.h"
+#include "Format.h"
+
+namespace BinData
+{
+    extern const char* intFieldFormatError;
+
+    /// @brief Provides the string conversions shared by the integer fields.
+    ///
+    /// The derived field only has to print its value in decimal through a
+    /// Print(std::ostream&) const member, which this class uses for both
+    /// ToString() and operator<<. Hex and binary strings are formatted
+    /// directly from the field's raw data.
+    ///
+    /// @tparam Derived The integer field deriving from this class.
+    /// @tparam Base The field class to extend, such as Field or FieldView.
+    template<typename Derived, typename Base = Field>
+    class IntFieldBase : public Base
+    {
+    public:
+        using Base::Base;
+
+        /// @brief Gets a decimal string representation of the data.
+        /// @return A decimal string representation of the data.
+        std::string ToString() const override
+        {
+            std::stringstream s;
+            static_cast<const Derived&>(*this).Print(s);
+            return s.str();
+        }
+
+        /// @brief Gets a string representation in the specified format.
+        /// @param f The format to use when converting to the string.
+        /// @return A string representation in the specified format.
+        /// @pre Format must be Bin, Hex, or Dec.
+        /// @throw InvalidFormat when an invalid format is specified.
+        /// @throw InvalidField when the field has no data, such as an
+        /// unbound view.
+        std::string ToString(Format f) const override
+        {
+            // Data() is not const, but the formatting functions only read.
+            char* bytes = const_cast<IntFieldBase*>(this)->Data();
+            if (bytes == nullptr)
+                throw InvalidField{ nullFieldError };
+            switch (f)
+            {
+                case Format::Hex:
+                    return FormatHex(bytes, this->Size());
+                case Format::Bin:
+                    return FormatBin(bytes, this->Size());
+                case Format::Ascii:
+                    throw InvalidFormat{ intFieldFormatError };
+                default:
+                    return ToString();
+            }
+        }
+    };
+
+    template<typename Derived, typename Base>
+    std::ostream& operator<<(std::ostream& os, 
+        const IntFieldBase<Derived, Base>& f)
+    {
+        static_cast<const Derived&>(f).Print(os);
+        return os;
+    }
+}
+
+#endif
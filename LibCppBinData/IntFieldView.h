@@ -0,0 +1,107 @@
+// IntFieldView.h - Declares the IntFieldView class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissionsand
+// limitations under the License.
+
+#ifndef BIN_DATA_INT_FIELD_VIEW_H
+#define BIN_DATA_INT_FIELD_VIEW_H
+
+#include <cstddef>
+#include <ostream>
+#include "FieldView.h"
+#include "IntFieldBase.h"
+#include "Endianness.h"
+#include "IntConversion.h"
+
+namespace BinData
+{   
+    /// @brief A non-owning equivalent of IntField.
+    ///
+    /// Interprets size bytes at the bound location as an integer, using the
+    /// same conversion rules as IntField, without allocating or copying.
+    template<typename ValueType, std::size_t size>
+    class IntFieldView 
+        : public IntFieldBase<IntFieldView<ValueType, size>, FieldView>
+    {
+    public:
+        IntFieldView(Endianness endian = Endianness::Little) 
+            : endian{ endian }
+        { }
+
+        IntFieldView(char* data, Endianness endian = Endianness::Little)
+            : IntFieldBase<IntFieldView, FieldView>{ data }, endian{ endian }
+        { }
+
+        Endianness Endian() const
+        {
+            return endian;
+        }
+
+        void SetEndian(Endianness endian)
+        {
+            this->endian = endian;
+        }
+
+        /// @brief Gets the size of the field, in bytes.
+        /// @return The size of the raw field, in bytes.
+        std::size_t Size() const override
+        {
+            return size;
+        }
+
+        /// @brief Gets the value of the bound data as a native integer type.
+        /// @return The value of the data as a native integer type.
+        /// @throw InvalidField when the view is not bound.
+        ValueType Value() const
+        {
+            if (this->mData == nullptr)
+                throw InvalidField{ nullFieldError };
+            return DecodeInt<ValueType, size>(this->mData, endian);
+        }
+
+        /// @brief Stores the specified value in the bound data.
+        /// @param v The value to set the field to.
+        /// @throw InvalidField when the view is not bound.
+        void SetValue(ValueType v)
+        {
+            if (this->mData == nullptr)
+                throw InvalidField{ nullFieldError };
+            EncodeInt<ValueType, size>(this->mData, v, endian);
+        }
+
+        /// @brief Prints the value of the bound data in decimal.
+        /// @param os The stream to print the value to.
+        /// @throw InvalidField when the view is not bound.
+        void Print(std::ostream& os) const
+        {
+            os << Value();
+        }
+    private:
+        Endianness endian;
+    };
+
+    using UInt8FieldView = IntFieldView<unsigned int, 1>;
+    using UInt16FieldView = IntFieldView<unsigned int, 2>;
+    using UInt24FieldView = IntFieldView<unsigned long, 3>;
+    using UInt32FieldView = IntFieldView<unsigned long, 4>;
+    using UInt64FieldView = IntFieldView<unsigned long long, 8>;
+
+    using Int8FieldView = IntFieldView<int, 1>;
+    using Int16FieldView = IntFieldView<int, 2>;
+    using Int24FieldView = IntFieldView<long, 3>;
+    using Int32FieldView = IntFieldView<long, 4>;
+    using Int64FieldView = IntFieldView<long long, 8>;
+}
+
+#endif
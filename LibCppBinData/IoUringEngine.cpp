@@ -0,0 +1,269 @@
+// IoUringEngine.cpp - Defines the IoUringEngine class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cerrno>
+#include <cstring>
+#include <cstdint>
+#include <stdexcept>
+#include <algorithm>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#include "IoUringEngine.h"
+
+namespace BinData
+{
+    namespace
+    {
+        // The ring indexes are shared with the kernel, so they are accessed
+        // with the same acquire/release ordering liburing uses.
+        unsigned LoadAcquire(const unsigned* p)
+        {
+            return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+        }
+
+        void StoreRelease(unsigned* p, unsigned v)
+        {
+            __atomic_store_n(p, v, __ATOMIC_RELEASE);
+        }
+
+        void* MapRing(int ring, std::size_t size, off_t offset)
+        {
+            void* address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE, ring, offset);
+            if (address == MAP_FAILED)
+                throw std::runtime_error{ "Unable to map io_uring queues" };
+            return address;
+        }
+    }
+
+    bool IoUringEngine::IsSupported()
+    {
+        static const bool isSupported = []()
+        {
+            try
+            {
+                IoUringEngine probe{ 1 };
+                return true;
+            }
+            catch (const std::exception&)
+            {
+                return false;
+            }
+        }();
+        return isSupported;
+    }
+
+    IoUringEngine::IoUringEngine(std::size_t queueDepth)
+        : mRing{ -1 }, mSqRing{ nullptr }, mSqRingSize{ 0 }, 
+        mCqRing{ nullptr }, mCqRingSize{ 0 }, mSqes{ nullptr }, 
+        mSqesSize{ 0 }, mQueued{ 0 }, mInFlight{ 0 }
+    {
+        io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+        mRing = static_cast<int>(::syscall(__NR_io_uring_setup, 
+            static_cast<unsigned>(std::max<std::size_t>(queueDepth, 1)), 
+            &params));
+        if (mRing < 0)
+            throw std::runtime_error{ "Unable to set up io_uring" };
+
+        // IORING_FEAT_RW_CUR_POS arrived in the same release as the plain
+        // read and write operations, so it doubles as a check for them.
+        if ((params.features & IORING_FEAT_RW_CUR_POS) == 0)
+        {
+            ::close(mRing);
+            throw std::runtime_error{ "io_uring does not support reads" };
+        }
+
+        mSqRingSize = params.sq_off.array + 
+            params.sq_entries * sizeof(unsigned);
+        mCqRingSize = params.cq_off.cqes + 
+            params.cq_entries * sizeof(io_uring_cqe);
+        mSqesSize = params.sq_entries * sizeof(io_uring_sqe);
+
+        try
+        {
+            // Newer kernels let both rings share a single mapping.
+            if (params.features & IORING_FEAT_SINGLE_MMAP)
+            {
+                mSqRingSize = std::max(mSqRingSize, mCqRingSize);
+                mCqRingSize = mSqRingSize;
+                mSqRing = MapRing(mRing, mSqRingSize, IORING_OFF_SQ_RING);
+                mCqRing = mSqRing;
+            }
+            else
+            {
+                mSqRing = MapRing(mRing, mSqRingSize, IORING_OFF_SQ_RING);
+                mCqRing = MapRing(mRing, mCqRingSize, IORING_OFF_CQ_RING);
+            }
+            mSqes = static_cast<io_uring_sqe*>(
+                MapRing(mRing, mSqesSize, IORING_OFF_SQES));
+        }
+        catch (...)
+        {
+            Unmap();
+            ::close(mRing);
+            throw;
+        }
+
+        char* sq = static_cast<char*>(mSqRing);
+        mSqHead = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        mSqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        mSqMask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        mSqEntries = params.sq_entries;
+        mSqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+
+        char* cq = static_cast<char*>(mCqRing);
+        mCqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        mCqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        mCqMask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        mCqEntries = params.cq_entries;
+        mCqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+    }
+
+    IoUringEngine::~IoUringEngine()
+    {
+        // Buffers still in flight belong to the caller, so wait for the
+        // kernel to finish with them before tearing the ring down.
+        try
+        {
+            std::vector<AsyncResult> discarded;
+            Reap(discarded, Pending());
+        }
+        catch (const std::exception&)
+        {
+        }
+
+        Unmap();
+        ::close(mRing);
+    }
+
+    void IoUringEngine::Enqueue(const AsyncRequest& request)
+    {
+        // The length of a submission is only 32 bits, so a larger request
+        // would silently be truncated into a short read or write.
+        if (request.size > UINT32_MAX)
+            throw std::runtime_error{ "Request is too large for io_uring" };
+
+        // Keep no more requests in the kernel than the completion queue can
+        // hold, so a completion is never dropped. Results reaped to make
+        // room are held back until the next call to Reap().
+        if (mQueued + mInFlight >= mCqEntries)
+        {
+            Enter(static_cast<unsigned>(mQueued), 1);
+            std::vector<AsyncResult> results;
+            Collect(results);
+            mBacklog.insert(mBacklog.end(), results.begin(), results.end());
+        }
+
+        unsigned tail = *mSqTail;
+        if (tail - LoadAcquire(mSqHead) >= mSqEntries)
+        {
+            Submit();
+            tail = *mSqTail;
+        }
+
+        unsigned index = tail & mSqMask;
+        io_uring_sqe* sqe = &mSqes[index];
+        std::memset(sqe, 0, sizeof(*sqe));
+        sqe->opcode = request.isWrite ? IORING_OP_WRITE : IORING_OP_READ;
+        sqe->fd = request.descriptor;
+        sqe->addr = reinterpret_cast<std::uint64_t>(request.data);
+        sqe->len = static_cast<std::uint32_t>(request.size);
+        sqe->off = request.offset;
+        sqe->user_data = request.id;
+
+        mSqArray[index] = index;
+        StoreRelease(mSqTail, tail + 1);
+        mQueued++;
+    }
+
+    std::size_t IoUringEngine::Submit()
+    {
+        std::size_t count = mQueued;
+        if (count > 0)
+            Enter(static_cast<unsigned>(count), 0);
+        return count;
+    }
+
+    std::size_t IoUringEngine::Reap(std::vector<AsyncResult>& results,
+        std::size_t minResults)
+    {
+        std::size_t count = mBacklog.size();
+        results.insert(results.end(), mBacklog.begin(), mBacklog.end());
+        mBacklog.clear();
+
+        std::size_t target = std::min(minResults, count + mQueued + mInFlight);
+        Submit();
+        count += Collect(results);
+        while (count < target)
+        {
+            Enter(static_cast<unsigned>(mQueued), 
+                static_cast<unsigned>(target - count));
+            count += Collect(results);
+        }
+
+        return count;
+    }
+
+    std::size_t IoUringEngine::Collect(std::vector<AsyncResult>& results)
+    {
+        unsigned head = *mCqHead;
+        unsigned tail = LoadAcquire(mCqTail);
+        std::size_t count = 0;
+        for (; head != tail; head++, count++)
+        {
+            const io_uring_cqe& cqe = mCqes[head & mCqMask];
+            results.push_back(AsyncResult{ cqe.user_data, cqe.res });
+        }
+
+        StoreRelease(mCqHead, head);
+        mInFlight -= count;
+        return count;
+    }
+
+    void IoUringEngine::Enter(unsigned toSubmit, unsigned minComplete)
+    {
+        unsigned flags = minComplete > 0 ? IORING_ENTER_GETEVENTS : 0;
+        while (true)
+        {
+            long submitted = ::syscall(__NR_io_uring_enter, mRing, toSubmit,
+                minComplete, flags, nullptr, 0);
+            if (submitted == -1 && errno == EINTR)
+                continue;
+            if (submitted == -1)
+                throw std::runtime_error{ "Unable to submit io_uring requests" };
+
+            mQueued -= static_cast<std::size_t>(submitted);
+            mInFlight += static_cast<std::size_t>(submitted);
+            return;
+        }
+    }
+
+    void IoUringEngine::Unmap()
+    {
+        if (mSqes != nullptr)
+            ::munmap(mSqes, mSqesSize);
+        if (mCqRing != nullptr && mCqRing != mSqRing)
+            ::munmap(mCqRing, mCqRingSize);
+        if (mSqRing != nullptr)
+            ::munmap(mSqRing, mSqRingSize);
+        mSqes = nullptr;
+        mCqRing = nullptr;
+        mSqRing = nullptr;
+    }
+}
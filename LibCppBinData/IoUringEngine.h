@@ -0,0 +1,103 @@
+// IoUringEngine.h - Declares the IoUringEngine class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIN_DATA_IO_URING_ENGINE_H
+#define BIN_DATA_IO_URING_ENGINE_H
+
+#include <cstddef>
+#include <vector>
+#include <deque>
+#include "AsyncEngine.h"
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace BinData
+{
+    /// @brief An AsyncEngine that uses a Linux io_uring instance.
+    ///
+    /// The ring is driven directly through the io_uring system calls, so
+    /// liburing is not needed. Requests are written into the submission
+    /// queue as they are enqueued and handed to the kernel in one 
+    /// io_uring_enter() call per Submit(), and results are read straight
+    /// from the completion queue.
+    ///
+    /// @remark This class is only available on Linux.
+    class IoUringEngine : public AsyncEngine
+    {
+    public:
+        /// @brief Determines if the running kernel supports this engine.
+        ///
+        /// The IORING_OP_READ and IORING_OP_WRITE operations it relies on
+        /// were added in Linux 5.6, and io_uring may also be disabled by
+        /// the system (e.g. by seccomp or the io_uring_disabled sysctl).
+        ///
+        /// @return True if an IoUringEngine can be constructed.
+        static bool IsSupported();
+
+        /// @brief Sets up a new io_uring instance.
+        /// @param queueDepth The number of submission queue entries.
+        /// @throw std::runtime_error if the ring cannot be set up.
+        IoUringEngine(std::size_t queueDepth);
+
+        IoUringEngine(const IoUringEngine&) = delete;
+
+        IoUringEngine& operator=(const IoUringEngine&) = delete;
+
+        ~IoUringEngine();
+
+        void Enqueue(const AsyncRequest& request) override;
+
+        std::size_t Submit() override;
+
+        std::size_t Reap(std::vector<AsyncResult>& results,
+            std::size_t minResults) override;
+
+        std::size_t Pending() const override
+        {
+            return mQueued + mInFlight + mBacklog.size();
+        }
+    private:
+        int mRing;
+        void* mSqRing;
+        std::size_t mSqRingSize;
+        void* mCqRing;
+        std::size_t mCqRingSize;
+        io_uring_sqe* mSqes;
+        std::size_t mSqesSize;
+        unsigned* mSqHead;
+        unsigned* mSqTail;
+        unsigned mSqMask;
+        unsigned mSqEntries;
+        unsigned* mSqArray;
+        unsigned* mCqHead;
+        unsigned* mCqTail;
+        unsigned mCqMask;
+        unsigned mCqEntries;
+        io_uring_cqe* mCqes;
+        std::size_t mQueued;
+        std::size_t mInFlight;
+        std::deque<AsyncResult> mBacklog;
+
+        std::size_t Collect(std::vector<AsyncResult>& results);
+
+        void Enter(unsigned toSubmit, unsigned minComplete);
+
+        void Unmap();
+    };
+}
+
+#endif
@@ -0,0 +1,80 @@
+// MemoryStream.cpp - Defines the MemoryStream class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <stdexcept>
+#include "MemoryStream.h"
+
+namespace BinData
+{
+    void MemoryStream::Open(FileMode m)
+    {
+        switch (m)
+        {
+        case FileMode::Read:
+            break;
+        case FileMode::Write:
+        case FileMode::WriteAppend:
+        case FileMode::ReadWrite:
+            if (IsReadOnly())
+                throw std::runtime_error{ "Memory stream is read only" };
+            break;
+        default:
+            throw std::runtime_error{ "An invalid FileMode was specified" };
+        }
+
+        if (m == FileMode::Write)
+            mBuffer.clear();
+        if (m == FileMode::WriteAppend)
+            mOffset = mBuffer.size();
+        mMode = m;
+        mIsOpen = true;
+    }
+
+    void MemoryStream::Read(Field* f)
+    {
+        ReadAt(mOffset, f);
+        mOffset += f->Size();
+    }
+
+    void MemoryStream::Write(Field* f)
+    {
+        if (IsReadOnly())
+            throw std::runtime_error{ "Memory stream is read only" };
+
+        std::size_t end = mOffset + f->Size();
+        if (end > mBuffer.size())
+            mBuffer.resize(end);
+        std::memcpy(mBuffer.data() + mOffset, f->Data(), f->Size());
+        mOffset = end;
+    }
+
+    char* MemoryStream::ReadView(std::size_t size)
+    {
+        if (mOffset + size > Size())
+            throw std::runtime_error{ "Cannot read beyond end of buffer" };
+        char* view = Begin() + mOffset;
+        mOffset += size;
+        return view;
+    }
+
+    void MemoryStream::ReadAt(std::size_t offset, Field* f)
+    {
+        if (offset + f->Size() > Size())
+            throw std::runtime_error{ "Cannot read beyond end of buffer" };
+        std::memcpy(f->Data(), Data() + offset, f->Size());
+    }
+}
@@ -0,0 +1,162 @@
+// MemoryStream.h - Declares the MemoryStream class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIN_DATA_MEMORY_STREAM_H
+#define BIN_DATA_MEMORY_STREAM_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "FileStream.h"
+
+namespace BinData
+{
+    /// @brief A FileStream over data that is already in memory.
+    ///
+    /// A RawFile built on a MemoryStream parses data received over the
+    /// network, decompressed, or otherwise produced in memory without first
+    /// writing it to disk. The stream either owns a buffer, which grows as
+    /// data is written to it, or reads from a span owned by the caller, in 
+    /// which case it is read only.
+    ///
+    /// The data outlives Close(), so written data can be collected with
+    /// Data() afterwards, and the stream always exists. FieldViews bind
+    /// directly to the data, so they are only valid until it is next grown
+    /// or, for a span, until the caller releases it.
+    class MemoryStream : public FileStream
+    {
+    public:
+        /// @brief Constructs a MemoryStream over an owned buffer.
+        /// @param data The initial contents of the buffer.
+        /// @param name The name to report as the stream's file name.
+        MemoryStream(std::vector<char> data = {}, 
+            std::string name = "memory")
+            : mName{ name }, mBuffer{ std::move(data) }, mSpan{ nullptr }, 
+            mSpanSize{ 0 }, mIsOpen{ false }, mMode{ FileMode::Read }, 
+            mOffset{ 0 }
+        {
+
+        }
+
+        /// @brief Constructs a read only MemoryStream over a caller's span.
+        ///
+        /// The stream never writes to the span, but FieldViews read from
+        /// it point straight into it, so changing a view changes the span.
+        ///
+        /// @param data A pointer to the data, which must outlive the stream.
+        /// @param size The size of the data, in bytes.
+        /// @param name The name to report as the stream's file name.
+        MemoryStream(char* data, std::size_t size, 
+            std::string name = "memory")
+            : mName{ name }, mSpan{ data }, mSpanSize{ size }, 
+            mIsOpen{ false }, mMode{ FileMode::Read }, mOffset{ 0 }
+        {
+
+        }
+
+        std::string FileName() const override
+        {
+            return mName;
+        }
+
+        bool IsOpen() const override
+        {
+            return mIsOpen;
+        }
+
+        bool Exists() const override
+        {
+            return true;
+        }
+
+        std::size_t Offset() const override
+        {
+            return mOffset;
+        }
+
+        FileMode Mode() const override
+        {
+            return mMode;
+        }
+
+        std::size_t Size() const override
+        {
+            return IsReadOnly() ? mSpanSize : mBuffer.size();
+        }
+
+        /// @brief Determines if the stream reads from a caller's span.
+        bool IsReadOnly() const
+        {
+            return mSpan != nullptr;
+        }
+
+        /// @brief Gets a pointer to the stream's data.
+        /// @return The data, which is Size() bytes long.
+        const char* Data() const
+        {
+            return IsReadOnly() ? mSpan : mBuffer.data();
+        }
+
+        /// @brief Opens the stream.
+        ///
+        /// As with a file, Write discards the existing data and WriteAppend
+        /// moves the offset to the end.
+        ///
+        /// @param m The mode to open the stream in.
+        /// @pre A read only stream can only be opened for reading.
+        void Open(FileMode m = FileMode::Read) override;
+
+        void Close() override
+        {
+            mIsOpen = false;
+        }
+
+        void Read(Field* f) override;
+
+        void Write(Field* f) override;
+
+        void SetOffset(std::size_t o) override
+        {
+            mOffset = o;
+        }
+
+        char* ReadView(std::size_t size) override;
+
+        /// @brief Reads data at the specified offset without locking.
+        ///
+        /// Any number of threads may read concurrently, as long as none of
+        /// them writes to the stream.
+        ///
+        /// @param offset The offset to read from.
+        /// @param f The field to read into.
+        void ReadAt(std::size_t offset, Field* f) override;
+    private:
+        std::string mName;
+        std::vector<char> mBuffer;
+        char* mSpan;
+        std::size_t mSpanSize;
+        bool mIsOpen;
+        FileMode mMode;
+        std::size_t mOffset;
+
+        char* Begin()
+        {
+            return IsReadOnly() ? mSpan : mBuffer.data();
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,249 @@
+// MmapFileStream.cpp - Defines the MmapFileStream class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <stdexcept>
+#include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "MmapFileStream.h"
+
+namespace BinData
+{
+    MmapFileStream::~MmapFileStream()
+    {
+        if (IsOpen())
+            Close();
+    }
+
+    std::size_t MmapFileStream::Size() const
+    {
+        if (IsOpen())
+            return mSize;
+        else if (std::filesystem::exists(mFileName))
+            return std::filesystem::file_size(mFileName);
+        else
+            return 0;
+    }
+
+    void MmapFileStream::Open(FileMode m)
+    {
+        if (IsOpen())
+            throw std::runtime_error{ "File is already open" };
+
+        int flags;
+        switch (m)
+        {
+        case FileMode::Read:
+            flags = O_RDONLY;
+            break;
+        case FileMode::Write:
+            flags = O_RDWR | O_CREAT | O_TRUNC;
+            break;
+        case FileMode::WriteAppend:
+        case FileMode::ReadWrite:
+            flags = O_RDWR | O_CREAT;
+            break;
+        default:
+            throw std::runtime_error{ "An invalid FileMode was specified" };
+        }
+
+        mDescriptor = ::open(mFileName.c_str(), flags, 0644);
+        if (mDescriptor == -1)
+            throw std::runtime_error{ "Unable to open file" };
+
+        struct stat info;
+        if (::fstat(mDescriptor, &info) == -1)
+        {
+            ::close(mDescriptor);
+            mDescriptor = -1;
+            throw std::runtime_error{ "Unable to determine file size" };
+        }
+
+        mMode = m;
+        mSize = static_cast<std::size_t>(info.st_size);
+        if (m == FileMode::WriteAppend)
+            mOffset = mSize;
+
+        try
+        {
+            Map(mSize);
+        }
+        catch (...)
+        {
+            ::close(mDescriptor);
+            mDescriptor = -1;
+            throw;
+        }
+    }
+
+    void MmapFileStream::Close()
+    {
+        Unmap();
+
+        // The mapping may have been grown beyond the data that was actually
+        // written, so trim the file back to its logical size.
+        if (IsWritable())
+            ::ftruncate(mDescriptor, static_cast<off_t>(mSize));
+
+        ::close(mDescriptor);
+        mDescriptor = -1;
+    }
+
+    void MmapFileStream::Read(Field* f)
+    {
+        if (mOffset + f->Size() > mSize)
+            throw std::runtime_error{ "Cannot read beyond end of mapping" };
+        std::memcpy(f->Data(), mMap + mOffset, f->Size());
+        mOffset += f->Size();
+    }
+
+    void MmapFileStream::Write(Field* f)
+    {
+        // Files opened for reading are mapped copy-on-write, so a write
+        // would silently land in a private copy rather than the file.
+        if (!IsWritable())
+            throw std::runtime_error{ "Cannot write to a read only file" };
+
+        std::size_t end = mOffset + f->Size();
+        Reserve(end);
+        std::memcpy(mMap + mOffset, f->Data(), f->Size());
+        mOffset = end;
+        if (mOffset > mSize)
+            mSize = mOffset;
+    }
+
+    char* MmapFileStream::ReadView(std::size_t size)
+    {
+        if (mOffset + size > mSize)
+            throw std::runtime_error{ "Cannot read beyond end of mapping" };
+        char* view = mMap + mOffset;
+        mOffset += size;
+        return view;
+    }
+
+    void MmapFileStream::ReadAt(std::size_t offset, Field* f)
+    {
+        if (offset + f->Size() > mSize)
+            throw std::runtime_error{ "Cannot read beyond end of mapping" };
+        std::memcpy(f->Data(), mMap + offset, f->Size());
+    }
+
+    void MmapFileStream::Advise(AccessPattern pattern, std::size_t offset,
+        std::size_t size)
+    {
+        int advice;
+        switch (pattern)
+        {
+        case AccessPattern::Sequential:
+            advice = MADV_SEQUENTIAL;
+            break;
+        case AccessPattern::Random:
+            advice = MADV_RANDOM;
+            break;
+        case AccessPattern::WillNeed:
+            advice = MADV_WILLNEED;
+            break;
+        case AccessPattern::DontNeed:
+            // Dropping the pages of a private mapping would throw away any
+            // changes made through views, which MADV_COLD leaves intact.
+            if (IsWritable())
+            {
+                advice = MADV_DONTNEED;
+                break;
+            }
+#ifdef MADV_COLD
+            advice = MADV_COLD;
+            break;
+#else
+            return;
+#endif
+        default:
+            advice = MADV_NORMAL;
+            break;
+        }
+
+        bool isWholeFile = pattern == AccessPattern::Normal || 
+            pattern == AccessPattern::Sequential || 
+            pattern == AccessPattern::Random;
+        if (isWholeFile)
+        {
+            mPattern = pattern;
+            offset = 0;
+            size = 0;
+        }
+        if (mMap == nullptr || offset >= mCapacity)
+            return;
+
+        // madvise() requires the start of the range to be page aligned.
+        std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        std::size_t start = offset / page * page;
+        std::size_t end = size == 0 ? mCapacity : 
+            std::min(mCapacity, offset + size);
+        ::madvise(mMap + start, end - start, advice);
+    }
+
+    void MmapFileStream::Map(std::size_t capacity)
+    {
+        // A zero length mapping is not permitted, so empty files simply
+        // remain unmapped until the first write reserves space for them.
+        if (capacity == 0)
+            return;
+
+        // Read only files are mapped privately so that writing through a
+        // view only ever touches a copy-on-write page, never the file.
+        int flags = IsWritable() ? MAP_SHARED : MAP_PRIVATE;
+        void* address = ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE,
+            flags, mDescriptor, 0);
+        if (address == MAP_FAILED)
+            throw std::runtime_error{ "Unable to map file into memory" };
+
+        mMap = static_cast<char*>(address);
+        mCapacity = capacity;
+        if (mPattern != AccessPattern::Normal)
+            Advise(mPattern);
+    }
+
+    void MmapFileStream::Unmap()
+    {
+        if (mMap != nullptr)
+            ::munmap(mMap, mCapacity);
+        mMap = nullptr;
+        mCapacity = 0;
+    }
+
+    void MmapFileStream::Reserve(std::size_t size)
+    {
+        if (size <= mCapacity)
+            return;
+
+        // Grow geometrically so a long run of small sequential writes only
+        // remaps the file a logarithmic number of times.
+        std::size_t capacity = std::max(size, mCapacity * 2);
+        if (::ftruncate(mDescriptor, static_cast<off_t>(capacity)) == -1)
+            throw std::runtime_error{ "Unable to grow file" };
+
+        // Map the larger region before releasing the old one so that if the
+        // mapping fails, the stream is left with its existing, valid view.
+        char* previous = mMap;
+        std::size_t previousCapacity = mCapacity;
+        Map(capacity);
+        if (previous != nullptr)
+            ::munmap(previous, previousCapacity);
+    }
+}
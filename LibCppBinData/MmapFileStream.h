@@ -0,0 +1,143 @@
+// MmapFileStream.h - Declares the MmapFileStream class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIN_DATA_MMAP_FILE_STREAM_H
+#define BIN_DATA_MMAP_FILE_STREAM_H
+
+#include <cstddef>
+#include <string>
+#include <filesystem>
+#include "FileStream.h"
+
+namespace BinData
+{
+    /// @brief A FileStream that services reads and writes from a memory map.
+    ///
+    /// The whole file is mapped into memory when it is opened, so reading
+    /// or writing a field is a single memcpy against the mapping rather than
+    /// a call into the C++ stream library. When a write extends past the end
+    /// of the mapping, the file is grown and remapped. The file is truncated
+    /// back to its logical size when it is closed.
+    ///
+    /// Files opened for reading are mapped copy-on-write, so FieldViews
+    /// bound to the mapping may be modified without altering the file.
+    ///
+    /// @remark This class is only available on POSIX platforms.
+    class MmapFileStream : public FileStream
+    {
+    public:
+        MmapFileStream(std::string fileName)
+            : mFileName{ fileName }, mDescriptor{ -1 }, mMap{ nullptr },
+            mCapacity{ 0 }, mMode{ FileMode::Read }, mSize{ 0 }, mOffset{ 0 },
+            mPattern{ AccessPattern::Normal }
+        {
+
+        }
+
+        MmapFileStream(const MmapFileStream&) = delete;
+
+        MmapFileStream& operator=(const MmapFileStream&) = delete;
+
+        ~MmapFileStream();
+
+        std::string FileName() const override
+        {
+            return mFileName;
+        }
+
+        bool IsOpen() const override
+        {
+            return mDescriptor != -1;
+        }
+
+        bool Exists() const override
+        {
+            return std::filesystem::exists(mFileName);
+        }
+
+        std::size_t Offset() const override
+        {
+            return mOffset;
+        }
+
+        FileMode Mode() const override
+        {
+            return mMode;
+        }
+
+        std::size_t Size() const override;
+
+        void Open(FileMode m = FileMode::Read) override;
+
+        void Close() override;
+
+        void Read(Field* f) override;
+
+        void Write(Field* f) override;
+
+        void SetOffset(std::size_t o) override
+        {
+            mOffset = o;
+        }
+
+        char* ReadView(std::size_t size) override;
+
+        /// @brief Reads data at the specified offset without locking.
+        ///
+        /// The mapping is read directly, so any number of threads may read
+        /// concurrently as long as none of them grows the file.
+        ///
+        /// @param offset The offset to read from.
+        /// @param f The field to read into.
+        void ReadAt(std::size_t offset, Field* f) override;
+
+        /// @brief Passes the access pattern to madvise().
+        ///
+        /// Sequential, Random and Normal apply to the whole mapping and are
+        /// reapplied whenever the file is remapped. DontNeed never discards
+        /// changes made through views to a file opened for reading; where
+        /// the kernel cannot simply deprioritize those pages, it is ignored.
+        ///
+        /// @param pattern The expected access pattern.
+        /// @param offset The offset of the range the hint applies to.
+        /// @param size The size of the range, or zero for the rest of the
+        /// file.
+        void Advise(AccessPattern pattern, std::size_t offset = 0,
+            std::size_t size = 0) override;
+    private:
+        std::string mFileName;
+        int mDescriptor;
+        char* mMap;
+        std::size_t mCapacity;
+        FileMode mMode;
+        std::size_t mSize;
+        std::size_t mOffset;
+        AccessPattern mPattern;
+
+        bool IsWritable() const
+        {
+            return mMode != FileMode::Read;
+        }
+
+        void Map(std::size_t capacity);
+
+        void Unmap();
+
+        void Reserve(std::size_t size);
+    };
+}
+
+#endif
@@ -0,0 +1,56 @@
+// PackedChunkHeader.h - Declares the PackedChunkHeader class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIN_DATA_PACKED_CHUNK_HEADER_H
+#define BIN_DATA_PACKED_CHUNK_HEADER_H
+
+#include <memory>
+#include "StringFieldView.h"
+#include "IntFieldView.h"
+#include "PackedFieldStruct.h"
+#include "Endianness.h"
+
+namespace BinData
+{
+    /// @brief A ChunkHeader laid out in a single contiguous buffer.
+    ///
+    /// Reading a PackedChunkHeader from a File takes one stream read of 8
+    /// bytes instead of one read per field.
+    class PackedChunkHeader : public PackedFieldStruct
+    {
+    public:
+        PackedChunkHeader(Endianness endianness = Endianness::Little)
+        {
+            id = AddField<StringFieldView>(4);
+            size = AddField<UInt32FieldView>(endianness);
+        }
+
+        std::shared_ptr<StringFieldView> ID()
+        {
+            return id;
+        }
+
+        std::shared_ptr<UInt32FieldView> Size()
+        {
+            return size;
+        }
+    private:
+        std::shared_ptr<StringFieldView> id;
+        std::shared_ptr<UInt32FieldView> size;
+    };
+}
+
+#endif
@@ -0,0 +1,39 @@
+// PackedFieldStruct.cpp - Defines the PackedFieldStruct class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include "PackedFieldStruct.h"
+
+namespace BinData
+{
+    void PackedFieldStruct::Grow(std::size_t size)
+    {
+        auto buffer = std::make_unique<RawField>(mSize + size);
+        if (mBuffer != nullptr)
+            std::memcpy(buffer->Data(), mBuffer->Data(), mSize);
+        mBuffer = std::move(buffer);
+        mSize += size;
+
+        // Growing moves the buffer, so every field has to be rebound to its
+        // offset within the new one.
+        char* data = mBuffer->Data();
+        for (FieldView* view : mViews)
+        {
+            view->Bind(data);
+            data += view->Size();
+        }
+    }
+}
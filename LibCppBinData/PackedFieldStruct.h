@@ -0,0 +1,92 @@
+// PackedFieldStruct.h - Declares the PackedFieldStruct class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIN_DATA_PACKED_FIELD_STRUCT_H
+#define BIN_DATA_PACKED_FIELD_STRUCT_H
+
+#include <cstddef>
+#include <vector>
+#include <memory>
+#include <utility>
+#include "Field.h"
+#include "FieldView.h"
+#include "FieldStruct.h"
+#include "RawField.h"
+
+namespace BinData
+{
+    /// @brief A FieldStruct whose fields share a single contiguous buffer.
+    ///
+    /// Each field is a FieldView bound at a fixed offset inside one buffer
+    /// owned by the struct, laid out in the order the fields were added.
+    /// Because the fields are contiguous, a File can read or write the whole
+    /// struct with a single bounds check and a single stream call through
+    /// Buffer(), rather than one of each per field.
+    ///
+    /// Derived classes add their fields in their constructor with
+    /// AddField(), keeping the returned pointers as typed accessors.
+    class PackedFieldStruct : public FieldStruct
+    {
+    public:
+        PackedFieldStruct() : mSize{ 0 } { }
+
+        // The fields are bound to this instance's buffer, so a copy would
+        // share views that point at the original's memory.
+        PackedFieldStruct(const PackedFieldStruct&) = delete;
+
+        PackedFieldStruct& operator=(const PackedFieldStruct&) = delete;
+
+        std::vector<std::shared_ptr<Field>> Fields() const override
+        {
+            return mFields;
+        }
+
+        std::size_t TotalSize() const override
+        {
+            return mSize;
+        }
+
+        /// @brief Gets the field that spans the bytes of every field.
+        /// @return A pointer to the struct's buffer, or nullptr if empty.
+        Field* Buffer()
+        {
+            return mBuffer.get();
+        }
+    protected:
+        /// @brief Adds a field to the end of the struct.
+        /// @param args The arguments to construct the FieldView with.
+        /// @return The newly added field, bound inside the struct's buffer.
+        template<typename ViewType, typename... Args>
+        std::shared_ptr<ViewType> AddField(Args&&... args)
+        {
+            auto view = std::make_shared<ViewType>(
+                std::forward<Args>(args)...);
+            mFields.push_back(view);
+            mViews.push_back(view.get());
+            Grow(view->Size());
+            return view;
+        }
+    private:
+        std::vector<std::shared_ptr<Field>> mFields;
+        std::vector<FieldView*> mViews;
+        std::unique_ptr<RawField> mBuffer;
+        std::size_t mSize;
+
+        void Grow(std::size_t size);
+    };
+}
+
+#endif
@@ -0,0 +1,162 @@
+// ParallelChunkScanner.cpp - Defines the ParallelChunkScanner class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissionsand
+// limitations under the License.
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <exception>
+#include <algorithm>
+#include "ParallelChunkScanner.h"
+#include "File.h"
+
+namespace BinData
+{
+    ParallelChunkScanner::ParallelChunkScanner(File* file, 
+        std::size_t threadCount, Endianness endianness)
+        : mFile{ file }, mThreadCount{ threadCount }, mEndianness{ endianness }
+    {
+        if (mFile == nullptr)
+            throw InvalidFile{ "file cannot be null" };
+
+        // hardware_concurrency() may return 0 when it cannot be determined.
+        if (mThreadCount == 0)
+            mThreadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    void ParallelChunkScanner::Scan(Callback callback)
+    {
+        Process(FindChunks(nullptr), callback);
+    }
+
+    void ParallelChunkScanner::Scan(std::string ID, Callback callback)
+    {
+        Process(FindChunks(&ID), callback);
+    }
+
+    std::vector<ChunkInfo> ParallelChunkScanner::FindChunks(
+        const std::string* ID)
+    {
+        std::size_t start = mFile->Offset();
+        std::vector<ChunkInfo> chunks;
+        for (const ChunkInfo& chunk : mFile->Chunks(mEndianness))
+        {
+            if (ID == nullptr || chunk.ID() == *ID)
+                chunks.push_back(chunk);
+        }
+        mFile->SetOffset(start);
+
+        // A chunk whose size runs past the end of the file cannot be read,
+        // and is treated as the end of the chain.
+        auto truncated = std::find_if(chunks.begin(), chunks.end(), 
+            [this](const ChunkInfo& c) { return c.EndOffset() > mFile->Size(); });
+        chunks.erase(truncated, chunks.end());
+        return chunks;
+    }
+
+    void ParallelChunkScanner::AdviseChunks(
+        const std::vector<ChunkInfo>& chunks)
+    {
+        // Every payload is about to be read, so let the file start fetching
+        // them all at once. Payloads separated only by a chunk header (and
+        // its padding byte) are merged into one hint to save system calls.
+        std::size_t start = 0;
+        std::size_t end = 0;
+        for (const ChunkInfo& chunk : chunks)
+        {
+            if (chunk.size == 0)
+                continue;
+            bool isAdjacent = 
+                chunk.PayloadOffset() <= end + chunkHeaderSize + 1;
+            if (end > start && isAdjacent)
+            {
+                end = chunk.EndOffset();
+                continue;
+            }
+            if (end > start)
+                mFile->Advise(AccessPattern::WillNeed, start, end - start);
+            start = chunk.PayloadOffset();
+            end = chunk.EndOffset();
+        }
+        if (end > start)
+            mFile->Advise(AccessPattern::WillNeed, start, end - start);
+    }
+
+    void ParallelChunkScanner::Process(const std::vector<ChunkInfo>& chunks, 
+        Callback& callback)
+    {
+        AdviseChunks(chunks);
+
+        // Workers claim the next unprocessed chunk until none remain, which
+        // balances the load when chunk sizes vary widely.
+        std::atomic<std::size_t> next{ 0 };
+        std::atomic<bool> isFailed{ false };
+        std::exception_ptr error;
+        std::mutex errorMutex;
+
+        auto work = [&]()
+        {
+            std::size_t i;
+            while (!isFailed && (i = next++) < chunks.size())
+            {
+                try
+                {
+                    const ChunkInfo& chunk = chunks[i];
+                    if (chunk.size == 0)
+                    {
+                        callback(chunk, nullptr);
+                        continue;
+                    }
+
+                    RawField payload{ chunk.size };
+                    mFile->ReadAt(chunk.PayloadOffset(), &payload);
+                    callback(chunk, &payload);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock{ errorMutex };
+                    if (error == nullptr)
+                        error = std::current_exception();
+                    isFailed = true;
+                }
+            }
+        };
+
+        std::size_t threadCount = std::min(mThreadCount, chunks.size());
+        std::vector<std::thread> workers;
+        try
+        {
+            for (std::size_t t = 1; t < threadCount; t++)
+                workers.emplace_back(work);
+        }
+        catch (...)
+        {
+            // The workers already started refer to the state on this stack
+            // frame, so they must finish before the exception unwinds it.
+            isFailed = true;
+            for (std::thread& worker : workers)
+                worker.join();
+            throw;
+        }
+
+        // The calling thread does its share of the work too.
+        work();
+        for (std::thread& worker : workers)
+            worker.join();
+
+        if (error != nullptr)
+            std::rethrow_exception(error);
+    }
+}
@@ -0,0 +1,100 @@
+// ParallelChunkScanner.h - Declares the ParallelChunkScanner class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissionsand
+// limitations under the License.
+
+#ifndef BIN_DATA_PARALLEL_CHUNK_SCANNER_H
+#define BIN_DATA_PARALLEL_CHUNK_SCANNER_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <functional>
+#include "Endianness.h"
+#include "ChunkInfo.h"
+#include "RawField.h"
+
+namespace BinData
+{
+    class File;
+
+    /// @brief Processes the payloads of a file's chunks on several threads.
+    ///
+    /// A scan first walks the chain of chunks that begins at the file's
+    /// current offset to find the chunk boundaries, which only reads the
+    /// headers. The chunks are then shared out among a pool of worker
+    /// threads, which read each payload with File::ReadAt() and pass it to
+    /// the callback. Positional reads leave the file's offset alone, so the
+    /// workers do not contend over a single cursor.
+    ///
+    /// How much the reads themselves overlap depends on the file's stream.
+    /// MmapFileStream reads without locking, while the default ReadAt()
+    /// serializes reads behind a lock. The callbacks always run in parallel.
+    class ParallelChunkScanner
+    {
+    public:
+        /// @brief The function called for each chunk that is scanned.
+        ///
+        /// The payload is only valid for the duration of the call, and is
+        /// nullptr if the chunk's payload is empty. Callbacks for different
+        /// chunks may be made concurrently and in any order.
+        using Callback = std::function<void(const ChunkInfo&, RawField*)>;
+
+        /// @brief Constructs a scanner over the chunks of the specified file.
+        /// @param file The file to scan the chunks of.
+        /// @param threadCount The number of worker threads to use, or 0 to
+        /// use one per hardware thread.
+        /// @param endianness The endianness of the chunk sizes.
+        /// @invariant The file must outlive the scanner.
+        ParallelChunkScanner(File* file, std::size_t threadCount = 0,
+            Endianness endianness = Endianness::Little);
+
+        /// @brief Gets the number of worker threads used for each scan.
+        /// @return The number of worker threads.
+        std::size_t ThreadCount() const
+        {
+            return mThreadCount;
+        }
+
+        /// @brief Calls the callback for every chunk in the file.
+        ///
+        /// Returns once every callback has completed. If a callback throws,
+        /// the remaining chunks are abandoned and the first exception is
+        /// rethrown once the workers have stopped.
+        ///
+        /// @param callback The function to call for each chunk.
+        /// @pre The file must be opened for reading.
+        /// @post The offset is unchanged.
+        void Scan(Callback callback);
+
+        /// @brief Calls the callback for every chunk with the specified ID.
+        /// @param ID The ID of the chunks to process.
+        /// @param callback The function to call for each matching chunk.
+        /// @pre The file must be opened for reading.
+        /// @post The offset is unchanged.
+        void Scan(std::string ID, Callback callback);
+    private:
+        File* mFile;
+        std::size_t mThreadCount;
+        Endianness mEndianness;
+
+        std::vector<ChunkInfo> FindChunks(const std::string* ID);
+
+        void AdviseChunks(const std::vector<ChunkInfo>& chunks);
+
+        void Process(const std::vector<ChunkInfo>& chunks, Callback& callback);
+    };
+}
+
+#endif
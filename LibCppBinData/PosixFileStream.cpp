@@ -0,0 +1,268 @@
+// PosixFileStream.cpp - Defines the PosixFileStream class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cerrno>
+#include <climits>
+#include <stdexcept>
+#include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include "PosixFileStream.h"
+
+namespace BinData
+{
+    namespace
+    {
+        // Transfers the fields, in order, starting at the specified offset
+        // with as few preadv()/pwritev() calls as the kernel allows.
+        std::size_t TransferV(int descriptor, 
+            const std::vector<Field*>& fields, std::size_t offset, 
+            bool isWrite)
+        {
+            std::vector<iovec> vectors;
+            vectors.reserve(fields.size());
+            for (Field* f : fields)
+                vectors.push_back(iovec{ f->Data(), f->Size() });
+
+            std::size_t total = 0;
+            std::size_t first = 0;
+            while (first < vectors.size())
+            {
+                int count = static_cast<int>(std::min<std::size_t>(
+                    vectors.size() - first, IOV_MAX));
+                ssize_t done = isWrite ?
+                    ::pwritev(descriptor, &vectors[first], count, 
+                        static_cast<off_t>(offset)) :
+                    ::preadv(descriptor, &vectors[first], count, 
+                        static_cast<off_t>(offset));
+                if (done == -1 && errno == EINTR)
+                    continue;
+                if (done == -1 && isWrite)
+                    throw std::runtime_error{ "Unable to write to file" };
+                if (done == -1)
+                    throw std::runtime_error{ "Unable to read from file" };
+                if (done == 0 && isWrite)
+                    throw std::runtime_error{ "Unable to write to file" };
+                if (done == 0)
+                    throw std::runtime_error{ "Cannot read beyond end of file" };
+
+                offset += static_cast<std::size_t>(done);
+                total += static_cast<std::size_t>(done);
+
+                // Skip past the buffers that were transferred in full, and
+                // trim the front off one that was only partly transferred.
+                std::size_t remaining = static_cast<std::size_t>(done);
+                while (first < vectors.size() && 
+                    remaining >= vectors[first].iov_len)
+                {
+                    remaining -= vectors[first].iov_len;
+                    first++;
+                }
+                if (remaining > 0)
+                {
+                    char* base = static_cast<char*>(vectors[first].iov_base);
+                    vectors[first].iov_base = base + remaining;
+                    vectors[first].iov_len -= remaining;
+                }
+            }
+
+            return total;
+        }
+    }
+
+    PosixFileStream::~PosixFileStream()
+    {
+        if (IsOpen())
+            Close();
+    }
+
+    std::size_t PosixFileStream::Size() const
+    {
+        if (IsOpen())
+            return mSize;
+        else if (std::filesystem::exists(mFileName))
+            return std::filesystem::file_size(mFileName);
+        else
+            return 0;
+    }
+
+    void PosixFileStream::Open(FileMode m)
+    {
+        if (IsOpen())
+            throw std::runtime_error{ "File is already open" };
+
+        // O_APPEND is deliberately not used for WriteAppend, as it would
+        // make pwrite() ignore its offset on Linux. Starting at the end of
+        // the file has the same effect for sequential writes.
+        int flags;
+        switch (m)
+        {
+        case FileMode::Read:
+            flags = O_RDONLY;
+            break;
+        case FileMode::Write:
+            flags = O_WRONLY | O_CREAT | O_TRUNC;
+            break;
+        case FileMode::WriteAppend:
+            flags = O_WRONLY | O_CREAT;
+            break;
+        case FileMode::ReadWrite:
+            flags = O_RDWR | O_CREAT;
+            break;
+        default:
+            throw std::runtime_error{ "An invalid FileMode was specified" };
+        }
+
+        mDescriptor = ::open(mFileName.c_str(), flags, 0644);
+        if (mDescriptor == -1)
+            throw std::runtime_error{ "Unable to open file" };
+
+        struct stat info;
+        if (::fstat(mDescriptor, &info) == -1)
+        {
+            ::close(mDescriptor);
+            mDescriptor = -1;
+            throw std::runtime_error{ "Unable to determine file size" };
+        }
+
+        mMode = m;
+        mSize = static_cast<std::size_t>(info.st_size);
+        if (m == FileMode::WriteAppend)
+            mOffset = mSize;
+    }
+
+    void PosixFileStream::Close()
+    {
+        ::close(mDescriptor);
+        mDescriptor = -1;
+    }
+
+    void PosixFileStream::Read(Field* f)
+    {
+        ReadAt(mOffset, f);
+        mOffset += f->Size();
+    }
+
+    void PosixFileStream::Write(Field* f)
+    {
+        WriteAt(mOffset, f);
+        mOffset += f->Size();
+    }
+
+    void PosixFileStream::ReadV(const std::vector<Field*>& fields)
+    {
+        mOffset += TransferV(mDescriptor, fields, mOffset, false);
+    }
+
+    void PosixFileStream::WriteV(const std::vector<Field*>& fields)
+    {
+        mOffset += TransferV(mDescriptor, fields, mOffset, true);
+        GrowSize(mOffset);
+    }
+
+    void PosixFileStream::ReadAt(std::size_t offset, Field* f)
+    {
+        // pread() may transfer fewer bytes than requested, or be interrupted
+        // by a signal, so keep going until the whole field has been read.
+        char* data = f->Data();
+        std::size_t remaining = f->Size();
+        while (remaining > 0)
+        {
+            ssize_t count = ::pread(mDescriptor, data, remaining, 
+                static_cast<off_t>(offset));
+            if (count == -1 && errno == EINTR)
+                continue;
+            if (count == -1)
+                throw std::runtime_error{ "Unable to read from file" };
+            if (count == 0)
+                throw std::runtime_error{ "Cannot read beyond end of file" };
+
+            data += count;
+            offset += static_cast<std::size_t>(count);
+            remaining -= static_cast<std::size_t>(count);
+        }
+    }
+
+    void PosixFileStream::WriteAt(std::size_t offset, Field* f)
+    {
+        const char* data = f->Data();
+        std::size_t remaining = f->Size();
+        while (remaining > 0)
+        {
+            ssize_t count = ::pwrite(mDescriptor, data, remaining, 
+                static_cast<off_t>(offset));
+            if (count == -1 && errno == EINTR)
+                continue;
+            if (count == -1)
+                throw std::runtime_error{ "Unable to write to file" };
+            if (count == 0)
+                throw std::runtime_error{ "Unable to write to file" };
+
+            data += count;
+            offset += static_cast<std::size_t>(count);
+            remaining -= static_cast<std::size_t>(count);
+        }
+
+        GrowSize(offset);
+    }
+
+    void PosixFileStream::Advise(AccessPattern pattern, std::size_t offset,
+        std::size_t size)
+    {
+#ifdef POSIX_FADV_NORMAL
+        int advice;
+        switch (pattern)
+        {
+        case AccessPattern::Sequential:
+            advice = POSIX_FADV_SEQUENTIAL;
+            break;
+        case AccessPattern::Random:
+            advice = POSIX_FADV_RANDOM;
+            break;
+        case AccessPattern::WillNeed:
+            advice = POSIX_FADV_WILLNEED;
+            break;
+        case AccessPattern::DontNeed:
+            advice = POSIX_FADV_DONTNEED;
+            break;
+        default:
+            advice = POSIX_FADV_NORMAL;
+            break;
+        }
+
+        // The advice is only a hint, so there is nothing to do if the
+        // kernel declines it.
+        ::posix_fadvise(mDescriptor, static_cast<off_t>(offset),
+            static_cast<off_t>(size), advice);
+#else
+        // Platforms such as macOS have no posix_fadvise(), so the hint is
+        // simply ignored there.
+        static_cast<void>(pattern);
+        static_cast<void>(offset);
+        static_cast<void>(size);
+#endif
+    }
+
+    void PosixFileStream::GrowSize(std::size_t end)
+    {
+        std::size_t size = mSize;
+        while (end > size && !mSize.compare_exchange_weak(size, end))
+        {
+        }
+    }
+}
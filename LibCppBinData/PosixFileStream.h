@@ -0,0 +1,144 @@
+// PosixFileStream.h - Declares the PosixFileStream class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIN_DATA_POSIX_FILE_STREAM_H
+#define BIN_DATA_POSIX_FILE_STREAM_H
+
+#include <cstddef>
+#include <string>
+#include <atomic>
+#include <filesystem>
+#include "FileStream.h"
+
+namespace BinData
+{
+    /// @brief A FileStream built on POSIX positional I/O (pread/pwrite).
+    ///
+    /// Every read and write names its own offset, so the file descriptor
+    /// has no shared cursor. Read() and Write() simply track an offset of
+    /// their own, while ReadAt() and WriteAt() leave it untouched and need
+    /// no locking, letting many threads read (or write disjoint ranges of)
+    /// one open file concurrently.
+    ///
+    /// @remark This class is only available on POSIX platforms.
+    class PosixFileStream : public FileStream
+    {
+    public:
+        PosixFileStream(std::string fileName)
+            : mFileName{ fileName }, mDescriptor{ -1 }, 
+            mMode{ FileMode::Read }, mSize{ 0 }, mOffset{ 0 }
+        {
+
+        }
+
+        PosixFileStream(const PosixFileStream&) = delete;
+
+        PosixFileStream& operator=(const PosixFileStream&) = delete;
+
+        ~PosixFileStream();
+
+        std::string FileName() const override
+        {
+            return mFileName;
+        }
+
+        bool IsOpen() const override
+        {
+            return mDescriptor != -1;
+        }
+
+        bool Exists() const override
+        {
+            return std::filesystem::exists(mFileName);
+        }
+
+        std::size_t Offset() const override
+        {
+            return mOffset;
+        }
+
+        FileMode Mode() const override
+        {
+            return mMode;
+        }
+
+        std::size_t Size() const override;
+
+        void Open(FileMode m = FileMode::Read) override;
+
+        void Close() override;
+
+        void Read(Field* f) override;
+
+        void Write(Field* f) override;
+
+        void SetOffset(std::size_t o) override
+        {
+            mOffset = o;
+        }
+
+        /// @brief Reads into every field with as few preadv() calls as
+        /// possible (one, unless there are more fields than IOV_MAX).
+        /// @param fields The fields to read into, in file order.
+        void ReadV(const std::vector<Field*>& fields) override;
+
+        /// @brief Writes every field with as few pwritev() calls as possible.
+        /// @param fields The fields to write, in file order.
+        void WriteV(const std::vector<Field*>& fields) override;
+
+        /// @brief Reads data at the specified offset with pread().
+        /// @param offset The offset to read from.
+        /// @param f The field to read into.
+        void ReadAt(std::size_t offset, Field* f) override;
+
+        /// @brief Writes data at the specified offset with pwrite().
+        /// @param offset The offset to write to.
+        /// @param f The field to write.
+        void WriteAt(std::size_t offset, Field* f) override;
+
+        /// @brief Passes the access pattern to posix_fadvise(), where the
+        /// platform provides it.
+        /// @param pattern The expected access pattern.
+        /// @param offset The offset of the range the hint applies to.
+        /// @param size The size of the range, or zero for the rest of the
+        /// file.
+        void Advise(AccessPattern pattern, std::size_t offset = 0,
+            std::size_t size = 0) override;
+    protected:
+        /// @brief Gets the underlying file descriptor.
+        /// @return The file descriptor, or -1 if the file is not open.
+        int Descriptor() const
+        {
+            return mDescriptor;
+        }
+
+        /// @brief Records that data has been written up to the given end.
+        ///
+        /// Concurrent writers may each extend the file, so the recorded
+        /// size only ever grows.
+        ///
+        /// @param end The offset of the byte following the written data.
+        void GrowSize(std::size_t end);
+    private:
+        std::string mFileName;
+        int mDescriptor;
+        FileMode mMode;
+        std::atomic<std::size_t> mSize;
+        std::size_t mOffset;
+    };
+}
+
+#endif
@@ -0,0 +1,230 @@
+// PrefetchFileStream.cpp - Defines the PrefetchFileStream class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <algorithm>
+#include "RawFieldView.h"
+#include "PrefetchFileStream.h"
+
+namespace BinData
+{
+    namespace
+    {
+        constexpr std::size_t noOffset{ 
+            std::numeric_limits<std::size_t>::max() };
+    }
+
+    PrefetchFileStream::PrefetchFileStream(std::string fileName, 
+        std::size_t bufferSize, std::size_t bufferCount)
+        : PosixFileStream{ fileName }, mBuffers(bufferCount), 
+        mFilled{ bufferCount }, mEmpty{ bufferCount }, mStopping{ false }, 
+        mFinished{ false }, mCurrent{ 0 }, mHasCurrent{ false }, 
+        mNextOffset{ noOffset }
+    {
+        if (bufferSize == 0 || bufferCount == 0)
+        {
+            throw std::invalid_argument
+            { 
+                "A prefetch stream needs at least one non-empty buffer" 
+            };
+        }
+
+        for (Buffer& b : mBuffers)
+            b.data.resize(bufferSize);
+    }
+
+    PrefetchFileStream::~PrefetchFileStream()
+    {
+        Stop();
+    }
+
+    void PrefetchFileStream::Close()
+    {
+        Stop();
+        mHasCurrent = false;
+        mNextOffset = noOffset;
+        PosixFileStream::Close();
+    }
+
+    void PrefetchFileStream::Read(Field* f)
+    {
+        if (!IsPrefetching())
+        {
+            PosixFileStream::Read(f);
+            return;
+        }
+
+        // A field may straddle the boundary between two buffers.
+        std::size_t offset = Offset();
+        char* destination = f->Data();
+        std::size_t remaining = f->Size();
+        while (remaining > 0)
+        {
+            const Buffer& b = BufferAt(offset);
+            std::size_t start = offset - b.offset;
+            std::size_t count = std::min(remaining, b.size - start);
+            std::memcpy(destination, b.data.data() + start, count);
+            destination += count;
+            offset += count;
+            remaining -= count;
+        }
+        SetOffset(offset);
+    }
+
+    void PrefetchFileStream::ReadV(const std::vector<Field*>& fields)
+    {
+        // The data is already in memory, so scattering it one field at a
+        // time is cheaper than a system call.
+        if (IsPrefetching())
+            FileStream::ReadV(fields);
+        else
+            PosixFileStream::ReadV(fields);
+    }
+
+    const PrefetchFileStream::Buffer& PrefetchFileStream::BufferAt(
+        std::size_t offset)
+    {
+        while (true)
+        {
+            if (mHasCurrent)
+            {
+                const Buffer& current = mBuffers[mCurrent];
+                if (offset >= current.offset && 
+                    offset < current.offset + current.size)
+                {
+                    return current;
+                }
+
+                mEmpty.TryPush(mCurrent);
+                mHasCurrent = false;
+                Notify();
+            }
+
+            // Skipping over the buffers that are already on their way is
+            // cheap, but any further ahead, or back, means starting over.
+            std::size_t window = mBuffers.size() * mBuffers[0].data.size();
+            if (offset < mNextOffset || offset >= mNextOffset + window)
+                Restart(offset);
+
+            std::size_t index;
+            while (!mFilled.TryPop(index))
+            {
+                std::unique_lock<std::mutex> lock{ mWaitMutex };
+                mWaitCondition.wait(lock, [this]()
+                {
+                    return mFinished || !mFilled.IsEmpty();
+                });
+                if (mFinished && mFilled.IsEmpty())
+                    throw std::runtime_error{ "Cannot read beyond end of file" };
+            }
+
+            const Buffer& next = mBuffers[index];
+            if (next.error != nullptr)
+            {
+                // Leave the read-ahead to be restarted by the next read.
+                mNextOffset = noOffset;
+                std::rethrow_exception(next.error);
+            }
+            mCurrent = index;
+            mHasCurrent = true;
+            mNextOffset = next.offset + next.size;
+        }
+    }
+
+    void PrefetchFileStream::Restart(std::size_t offset)
+    {
+        Stop();
+        mFilled.Clear();
+        mEmpty.Clear();
+        for (std::size_t i = 0; i < mBuffers.size(); i++)
+            mEmpty.TryPush(i);
+        mHasCurrent = false;
+        mNextOffset = offset;
+        mStopping = false;
+        mFinished = false;
+        mThread = std::thread{ &PrefetchFileStream::Prefetch, this, offset };
+    }
+
+    void PrefetchFileStream::Stop()
+    {
+        if (!mThread.joinable())
+            return;
+        mStopping = true;
+        Notify();
+        mThread.join();
+    }
+
+    void PrefetchFileStream::Notify()
+    {
+        // Taking the lock, however briefly, ensures a thread that has just
+        // found its queue empty is either waiting already or will see the
+        // change, so the notification cannot slip in between.
+        {
+            std::lock_guard<std::mutex> lock{ mWaitMutex };
+        }
+        mWaitCondition.notify_all();
+    }
+
+    void PrefetchFileStream::Prefetch(std::size_t offset)
+    {
+        std::size_t end = Size();
+        while (offset < end)
+        {
+            std::size_t index;
+            while (!mEmpty.TryPop(index))
+            {
+                std::unique_lock<std::mutex> lock{ mWaitMutex };
+                mWaitCondition.wait(lock, [this]()
+                {
+                    return mStopping || !mEmpty.IsEmpty();
+                });
+                if (mStopping)
+                    return;
+            }
+            if (mStopping)
+                return;
+
+            // Errors are handed to the reading thread to be rethrown there.
+            Buffer& b = mBuffers[index];
+            b.offset = offset;
+            b.size = std::min(b.data.size(), end - offset);
+            b.error = nullptr;
+            bool failed = false;
+            try
+            {
+                RawFieldView view{ b.data.data(), b.size };
+                PosixFileStream::ReadAt(offset, &view);
+            }
+            catch (...)
+            {
+                b.error = std::current_exception();
+                failed = true;
+            }
+
+            std::size_t size = b.size;
+            mFilled.TryPush(index);
+            Notify();
+            if (failed)
+                break;
+            offset += size;
+        }
+
+        mFinished = true;
+        Notify();
+    }
+}
@@ -0,0 +1,115 @@
+// PrefetchFileStream.h - Declares the PrefetchFileStream class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIN_DATA_PREFETCH_FILE_STREAM_H
+#define BIN_DATA_PREFETCH_FILE_STREAM_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include "PosixFileStream.h"
+#include "SpscQueue.h"
+
+namespace BinData
+{
+    /// @brief The default size of each PrefetchFileStream buffer, in bytes.
+    constexpr std::size_t defaultPrefetchBufferSize{ 256 * 1024 };
+
+    /// @brief A PosixFileStream that reads ahead on a background thread.
+    ///
+    /// When the file is opened for reading, the first Read() starts a
+    /// thread that fills a ring of buffers with the data that follows,
+    /// handing each one over through a lock-free queue as soon as it is
+    /// full. Read() copies fields out of the oldest buffer and hands it back
+    /// once it has moved past it, so with two or more buffers the caller
+    /// decodes one buffer while the next is being read from disk.
+    ///
+    /// Moving the offset within or a short way past the buffered data costs
+    /// nothing, but moving it backwards or far ahead restarts the read-ahead
+    /// at the new offset, so this stream suits sequential scans. Files
+    /// opened for writing behave exactly as a PosixFileStream.
+    ///
+    /// @remark This class is only available on POSIX platforms.
+    class PrefetchFileStream : public PosixFileStream
+    {
+    public:
+        /// @brief Constructs a PrefetchFileStream.
+        /// @param fileName The name of the file.
+        /// @param bufferSize The size of each read-ahead buffer, in bytes.
+        /// @param bufferCount The number of buffers, which must be at least
+        /// two for reading and decoding to overlap.
+        PrefetchFileStream(std::string fileName, 
+            std::size_t bufferSize = defaultPrefetchBufferSize,
+            std::size_t bufferCount = 2);
+
+        PrefetchFileStream(const PrefetchFileStream&) = delete;
+
+        PrefetchFileStream& operator=(const PrefetchFileStream&) = delete;
+
+        ~PrefetchFileStream();
+
+        void Close() override;
+
+        /// @brief Reads data at the current offset from the read-ahead
+        /// buffers, waiting for the background thread if it is behind.
+        /// @param f The field to read into.
+        void Read(Field* f) override;
+
+        void ReadV(const std::vector<Field*>& fields) override;
+    private:
+        struct Buffer
+        {
+            std::vector<char> data;
+            std::size_t offset;
+            std::size_t size;
+            std::exception_ptr error;
+        };
+
+        std::vector<Buffer> mBuffers;
+        SpscQueue<std::size_t> mFilled;
+        SpscQueue<std::size_t> mEmpty;
+        std::thread mThread;
+        std::atomic<bool> mStopping;
+        std::atomic<bool> mFinished;
+        std::mutex mWaitMutex;
+        std::condition_variable mWaitCondition;
+        std::size_t mCurrent;
+        bool mHasCurrent;
+        std::size_t mNextOffset;
+
+        bool IsPrefetching() const
+        {
+            return IsOpen() && Mode() == FileMode::Read;
+        }
+
+        const Buffer& BufferAt(std::size_t offset);
+
+        void Restart(std::size_t offset);
+
+        void Stop();
+
+        void Notify();
+
+        void Prefetch(std::size_t offset);
+    };
+}
+
+#endif
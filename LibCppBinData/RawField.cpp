@@ -21,16 +21,24 @@ namespace BinData
     const char* rawFieldFormatError{ 
         "RawField can only be formatted as Bin, Hex, or Ascii" };
 
-    RawField::RawField(std::size_t size) : mSize{ size }
+    RawField::RawField(std::size_t size) : RawField{ size, defaultAlignment }
+    {
+
+    }
+
+    RawField::RawField(std::size_t size, std::size_t alignment) 
+        : mSize{ size }
     {
         if (size < minFieldSize)
             throw InvalidField{ fieldSizeError };
-        mData = std::make_unique<char[]>(size);
+        if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+            throw InvalidField{ "Field alignment must be a power of two" };
+        mData = AllocateAligned(size, alignment);
     }
 
     RawField::RawField(const RawField& f)
     {
-        mData = std::make_unique<char[]>(f.Size());
+        mData = AllocateAligned(f.Size(), f.Alignment());
         std::memcpy(mData.get(), f.mData.get(), f.Size());
         mSize = f.mSize;
     }
@@ -44,7 +52,7 @@ namespace BinData
 
     RawField& RawField::operator=(const RawField& f)
     {
-        mData = std::make_unique<char[]>(f.Size());
+        mData = AllocateAligned(f.Size(), f.Alignment());
         std::memcpy(mData.get(), f.mData.get(), f.Size());
         mSize = f.mSize;
         return *this;
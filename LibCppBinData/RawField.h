@@ -23,6 +23,7 @@
 #include <memory>
 #include "Field.h"
 #include "Format.h"
+#include "AlignedBuffer.h"
 
 namespace BinData
 {
@@ -36,6 +37,17 @@ namespace BinData
         /// @pre The size must be greater than or equal to minFieldSize.
         RawField(std::size_t size);
 
+        /// @brief Constructs a new RawField with aligned storage.
+        ///
+        /// Some I/O, such as reads from a file opened with O_DIRECT, can only
+        /// transfer data into memory aligned to the device's block size.
+        ///
+        /// @param size The size of the RawField, in bytes.
+        /// @param alignment The alignment of the field's data, in bytes.
+        /// @pre The size must be greater than or equal to minFieldSize.
+        /// @pre The alignment must be a power of two.
+        RawField(std::size_t size, std::size_t alignment);
+
         RawField(const RawField& f);
 
         RawField(RawField&& f);
@@ -82,11 +94,17 @@ namespace BinData
             return mData.get();
         }
 
+        /// @brief Gets the alignment of the field's data, in bytes.
+        std::size_t Alignment() const
+        {
+            return mData.get_deleter().alignment;
+        }
+
         friend std::ostream& operator<<(std::ostream& os, const RawField& f);
     protected:
         Format defaultFormat;
     private:
-        std::unique_ptr<char[]> mData;
+        AlignedBuffer mData;
         std::size_t mSize;
     };
 }
@@ -0,0 +1,66 @@
+// RawFieldView.cpp - Defines the RawFieldView class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "RawFieldView.h"
+#include "RawField.h"
+
+namespace BinData
+{
+    RawFieldView::RawFieldView(std::size_t size) : mSize{ size }
+    {
+        if (size < minFieldSize)
+            throw InvalidField{ fieldSizeError };
+    }
+
+    RawFieldView::RawFieldView(char* data, std::size_t size) 
+        : FieldView{ data }, mSize{ size }
+    {
+        if (size < minFieldSize)
+            throw InvalidField{ fieldSizeError };
+    }
+
+    std::string RawFieldView::ToString() const
+    {
+        if (mData == nullptr)
+            throw InvalidField{ nullFieldError };
+        return FormatHex(mData, mSize);
+    }
+
+    std::string RawFieldView::ToString(Format f) const
+    {
+        if (mData == nullptr)
+            throw InvalidField{ nullFieldError };
+        switch (f)
+        {
+            case Format::Ascii:
+                return FormatAscii(mData, mSize);
+            case Format::Bin:
+                return FormatBin(mData, mSize);
+            case Format::Hex:
+                return FormatHex(mData, mSize);
+            case Format::Dec:
+                throw InvalidFormat{ rawFieldFormatError };
+            default:
+                return ToString();
+        }
+    }
+
+    std::ostream& operator<<(std::ostream& os, const RawFieldView& f)
+    {
+        os << f.ToString();
+        return os;
+    }
+}
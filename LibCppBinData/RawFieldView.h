@@ -0,0 +1,75 @@
+// RawFieldView.h - Declares the RawFieldView class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIN_DATA_RAW_FIELD_VIEW_H
+#define BIN_DATA_RAW_FIELD_VIEW_H
+
+#include <cstddef>
+#include <string>
+#include <ostream>
+#include "FieldView.h"
+#include "Format.h"
+
+namespace BinData
+{
+    /// @brief A non-owning equivalent of RawField.
+    class RawFieldView : public FieldView
+    {
+    public:
+        /// @brief Constructs a new unbound RawFieldView.
+        /// @param size The size of the RawFieldView, in bytes.
+        /// @pre The size must be greater than or equal to minFieldSize.
+        RawFieldView(std::size_t size);
+
+        /// @brief Constructs a new RawFieldView bound to the specified data.
+        /// @param data A pointer to at least size bytes of data.
+        /// @param size The size of the RawFieldView, in bytes.
+        /// @pre The size must be greater than or equal to minFieldSize.
+        RawFieldView(char* data, std::size_t size);
+
+        /// @brief Gets the size of the field, in bytes.
+        /// @return The size of the raw field, in bytes.
+        std::size_t Size() const override
+        {
+            return mSize;
+        }
+
+        /// @brief Gets a string representation in the default format.
+        ///
+        /// Returns a string representation of the data in the default format,
+        /// which is StringFormat::Hex for RawFieldViews.
+        ///
+        /// @return A hexadecimal string representation of the data.
+        std::string ToString() const override;
+
+        /// @brief Gets a string representation in the specified format.
+        ///
+        /// Returns a string representation of the data in the specified 
+        /// format, which can be Bin, Hex, or Ascii.
+        ///
+        /// @param f The format to use when converting to the string.
+        /// @return A string representation in the specified format.
+        /// @pre The format must not be Dec, as that is reseved for IntField.
+        std::string ToString(Format f) const override;
+
+        friend std::ostream& operator<<(std::ostream& os, 
+            const RawFieldView& f);
+    private:
+        std::size_t mSize;
+    };
+}
+
+#endif
@@ -14,17 +14,19 @@
 // See the License for the specific language governing permissionsand
 // limitations under the License.
 
+#include <cstring>
+#include <algorithm>
 #include "RawFile.h"
 
 namespace BinData
 {
-    RawFile::RawFile(std::string fileName)
+    RawFile::RawFile(std::string fileName) : mUseChunkIndexFile{ false }
     {
         mStream = std::make_shared<StdFileStream>(fileName);
     }
 
     RawFile::RawFile(std::shared_ptr<FileStream> stream) 
-        : mStream{ stream }
+        : mStream{ stream }, mUseChunkIndexFile{ false }
     {
         if (mStream == nullptr)
             throw InvalidFile{ "file stream cannot be null" };
@@ -36,7 +38,12 @@ namespace BinData
             throw InvalidFileOperation{ "File is already open" };
         if (!Exists() && m == FileMode::Read)
             throw InvalidFileOperation{ "File does not exist" };
+        ResetChunkIndex();
         mStream->Open(m);
+
+        bool isReadable = m == FileMode::Read || m == FileMode::ReadWrite;
+        if (mUseChunkIndexFile && isReadable)
+            LoadChunkIndexFile();
     }
 
     void RawFile::Read(Field* f)
@@ -45,9 +52,100 @@ namespace BinData
             throw InvalidFileOperation{ "File is not open for reading" };
         if (mStream->Offset() + f->Size() > mStream->Size())
             throw InvalidFileOperation{ "Cannot read beyond end of file" };
+
+        // Views are bound directly to the stream's data when it can provide
+        // it. Otherwise, a view that is bound to a caller supplied buffer is
+        // read into like any other field.
+        auto view = dynamic_cast<FieldView*>(f);
+        if (view != nullptr)
+        {
+            char* data = mStream->ReadView(f->Size());
+            if (data != nullptr)
+            {
+                view->Bind(data);
+                return;
+            }
+            if (!view->IsBound())
+                throw InvalidFileOperation{ "Cannot read into unbound view" };
+        }
+
         mStream->Read(f);
     }
 
+    void RawFile::ReadAt(std::size_t offset, Field* f)
+    {
+        if (!IsOpenForReading())
+            throw InvalidFileOperation{ "File is not open for reading" };
+        if (offset + f->Size() > mStream->Size())
+            throw InvalidFileOperation{ "Cannot read beyond end of file" };
+
+        // Positional reads always copy, so views need a buffer to copy to.
+        auto view = dynamic_cast<FieldView*>(f);
+        if (view != nullptr && !view->IsBound())
+            throw InvalidFileOperation{ "Cannot read into unbound view" };
+
+        mStream->ReadAt(offset, f);
+    }
+
+    void RawFile::ReadMany(std::vector<ReadRequest> requests, 
+        std::size_t maxGap)
+    {
+        if (!IsOpenForReading())
+            throw InvalidFileOperation{ "File is not open for reading" };
+
+        std::size_t fileSize = mStream->Size();
+        for (const ReadRequest& r : requests)
+        {
+            if (r.offset + r.field->Size() > fileSize)
+                throw InvalidFileOperation{ "Cannot read beyond end of file" };
+            auto view = dynamic_cast<FieldView*>(r.field);
+            if (view != nullptr && !view->IsBound())
+                throw InvalidFileOperation{ "Cannot read into unbound view" };
+        }
+
+        std::sort(requests.begin(), requests.end(), 
+            [](const ReadRequest& a, const ReadRequest& b) 
+            { 
+                return a.offset < b.offset; 
+            });
+
+        std::size_t first = 0;
+        while (first < requests.size())
+        {
+            // Grow the run for as long as the next request starts within
+            // maxGap bytes of the end of everything in the run so far.
+            std::size_t start = requests[first].offset;
+            std::size_t end = start + requests[first].field->Size();
+            std::size_t last = first + 1;
+            while (last < requests.size() && 
+                requests[last].offset <= end + maxGap)
+            {
+                end = std::max(end, 
+                    requests[last].offset + requests[last].field->Size());
+                last++;
+            }
+
+            // A run of one needs no staging buffer to scatter from.
+            if (last - first == 1)
+            {
+                mStream->ReadAt(start, requests[first].field);
+            }
+            else
+            {
+                RawField run{ end - start };
+                mStream->ReadAt(start, &run);
+                for (std::size_t i = first; i < last; i++)
+                {
+                    Field* f = requests[i].field;
+                    std::memcpy(f->Data(), 
+                        run.Data() + (requests[i].offset - start), f->Size());
+                }
+            }
+
+            first = last;
+        }
+    }
+
     void RawFile::Write(Field* f)
     {
         if (!IsOpenForWriting())
@@ -59,43 +157,121 @@ namespace BinData
                 "Offset must not be beyond end of file" 
             };
         }
+        ResetChunkIndex();
         mStream->Write(f);
     }
 
+    void RawFile::WriteAt(std::size_t offset, Field* f)
+    {
+        if (!IsOpenForWriting())
+            throw InvalidFileOperation{ "File is not open for writing" };
+        if (offset > mStream->Size())
+        {
+            throw InvalidFileOperation
+            { 
+                "Offset must not be beyond end of file" 
+            };
+        }
+
+        // Several threads may be writing at once, so the index is dropped
+        // atomically, and only by the first of them to see it.
+        if (std::atomic_load(&mChunkIndex) != nullptr)
+            ResetChunkIndex();
+        mStream->WriteAt(offset, f);
+    }
+
     void RawFile::Read(FieldStruct* s)
     {
-        for (std::shared_ptr<Field> f : s->Fields())
-            Read(f.get());
+        // The fields of a packed struct are contiguous, so the whole struct
+        // can be read in one go through its buffer.
+        auto packed = dynamic_cast<PackedFieldStruct*>(s);
+        if (packed != nullptr)
+        {
+            if (packed->TotalSize() > 0)
+                Read(packed->Buffer());
+            return;
+        }
+
+        // Views are bound one at a time, as each may be bound in place.
+        std::vector<std::shared_ptr<Field>> fields = s->Fields();
+        bool hasViews = std::any_of(fields.begin(), fields.end(), 
+            [](const std::shared_ptr<Field>& f) 
+            { 
+                return dynamic_cast<FieldView*>(f.get()) != nullptr; 
+            });
+        if (hasViews)
+        {
+            for (std::shared_ptr<Field> f : fields)
+                Read(f.get());
+            return;
+        }
+
+        // Otherwise every field is read with one scatter read, which the
+        // stream can perform in a single system call if it supports it.
+        if (!IsOpenForReading())
+            throw InvalidFileOperation{ "File is not open for reading" };
+        std::vector<Field*> targets;
+        std::size_t totalSize = 0;
+        for (std::shared_ptr<Field> f : fields)
+        {
+            targets.push_back(f.get());
+            totalSize += f->Size();
+        }
+        if (mStream->Offset() + totalSize > mStream->Size())
+            throw InvalidFileOperation{ "Cannot read beyond end of file" };
+        mStream->ReadV(targets);
     }
 
     void RawFile::Write(FieldStruct* s)
     {
+        auto packed = dynamic_cast<PackedFieldStruct*>(s);
+        if (packed != nullptr)
+        {
+            if (packed->TotalSize() > 0)
+                Write(packed->Buffer());
+            return;
+        }
+
+        if (!IsOpenForWriting())
+            throw InvalidFileOperation{ "File is not open for writing" };
+        if (mStream->Offset() > mStream->Size())
+        {
+            throw InvalidFileOperation
+            { 
+                "Offset must not be beyond end of file" 
+            };
+        }
+
+        std::vector<Field*> sources;
         for (std::shared_ptr<Field> f : s->Fields())
-            Write(f.get());
+            sources.push_back(f.get());
+        ResetChunkIndex();
+        mStream->WriteV(sources);
     }
 
     std::shared_ptr<ChunkHeader> RawFile::FindChunkHeader(std::string ID,
         BinData::Endianness endianness)
     {
-        auto header = std::make_shared<ChunkHeader>(endianness);
+        const ChunkIndex& index = IndexChunks(endianness);
+        const ChunkInfo* chunk = index.Find(ID, mStream->Offset());
 
-        while (!mStream->IsAtEnd())
+        if (chunk == nullptr)
         {
-            Read(header.get());
-            std::string headerID = header->ID()->ToString();
-
-            if (headerID == ID)
-            {
-                return header;
-            }
-            else
-            {
-                std::size_t next = mStream->Offset() + header->Size()->Value();
-                mStream->SetOffset(next);
-            }
+            mStream->SetOffset(std::min(index.End(), mStream->Size()));
+            return nullptr;
         }
-        
-        return nullptr;
+
+        auto header = std::make_shared<ChunkHeader>(endianness);
+        std::memcpy(header->ID()->Data(), chunk->id.data(), chunk->id.size());
+        header->Size()->SetValue(chunk->size);
+        mStream->SetOffset(chunk->PayloadOffset());
+        return header;
+    }
+
+    std::vector<ChunkInfo> RawFile::FindChunks(std::string ID,
+        BinData::Endianness endianness)
+    {
+        return IndexChunks(endianness).FindAll(ID);
     }
 
     void RawFile::SetOffset(std::size_t o)
@@ -120,6 +296,79 @@ namespace BinData
         return correctMode && IsOpen();
     }
 
+    const ChunkIndex& RawFile::IndexChunks(Endianness endianness)
+    {
+        std::size_t start = mStream->Offset();
+        auto current = std::atomic_load(&mChunkIndex);
+        bool isCurrent = current != nullptr && 
+            current->Endian() == endianness && 
+            current->IsBoundary(start);
+        if (isCurrent)
+            return *current;
+
+        auto index = std::make_shared<ChunkIndex>(start, endianness);
+        PackedChunkHeader header{ endianness };
+        std::size_t offset = start;
+        
+        // Walk the chain one header at a time, skipping over each payload,
+        // until there is no longer room for another header.
+        while (offset + header.TotalSize() <= mStream->Size())
+        {
+            mStream->SetOffset(offset);
+            Read(&header);
+
+            ChunkInfo chunk;
+            std::memcpy(chunk.id.data(), header.ID()->Data(), chunk.id.size());
+            chunk.offset = offset;
+            chunk.size = header.Size()->Value();
+            index->Add(chunk);
+
+            offset = chunk.EndOffset();
+        }
+
+        mStream->SetOffset(start);
+        std::atomic_store(&mChunkIndex, index);
+
+        // Only persist indexes built from files opened read only, otherwise
+        // pending writes could change the file after the sidecar is keyed.
+        if (mUseChunkIndexFile && mStream->Mode() == FileMode::Read)
+            SaveChunkIndexFile(*index);
+
+        return *index;
+    }
+
+    void RawFile::LoadChunkIndexFile()
+    {
+        // The sidecar is purely an optimization, so any problem reading it
+        // simply means the chunks will be scanned as usual.
+        try
+        {
+            std::string name = mStream->FileName();
+            ChunkIndexFile indexFile{ ChunkIndexFile::SidecarName(name) };
+            std::atomic_store(&mChunkIndex, 
+                indexFile.Load(ChunkIndexKey::FromFile(name)));
+        }
+        catch (const std::exception&)
+        {
+            ResetChunkIndex();
+        }
+    }
+
+    void RawFile::SaveChunkIndexFile(const ChunkIndex& index)
+    {
+        // Failing to write the sidecar (e.g. in a read only directory) must
+        // not prevent the chunk search itself from succeeding.
+        try
+        {
+            std::string name = mStream->FileName();
+            ChunkIndexFile indexFile{ ChunkIndexFile::SidecarName(name) };
+            indexFile.Save(index, ChunkIndexKey::FromFile(name));
+        }
+        catch (const std::exception&)
+        {
+        }
+    }
+
     std::size_t RawFile::Size() const
     {
         return mStream->Size();
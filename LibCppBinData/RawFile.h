@@ -27,6 +27,11 @@
 #include "FileStream.h"
 #include "StdFileStream.h"
 #include "File.h"
+#include "FieldView.h"
+#include "PackedFieldStruct.h"
+#include "PackedChunkHeader.h"
+#include "ChunkIndex.h"
+#include "ChunkIndexFile.h"
 
 namespace BinData
 {
@@ -70,14 +75,68 @@ namespace BinData
         /// @post The offset must have advanced by field size.
         void Write(Field* f) override;
 
+        /// @brief Reads data at the specified offset into the field.
+        ///
+        /// The current offset is neither used nor changed, so several
+        /// threads may read from the same open file at once. Whether the
+        /// reads actually proceed in parallel depends on the FileStream.
+        ///
+        /// @param offset The offset to read from.
+        /// @param f The pointer to the binary data field to read into.
+        /// @pre The file must be opened for reading.
+        /// @pre There must be enough data remaining at the offset.
+        void ReadAt(std::size_t offset, Field* f) override;
+
+        /// @brief Reads a batch of fields from arbitrary offsets.
+        ///
+        /// Overlapping and nearly adjacent requests are coalesced into a
+        /// single positional read. See File::ReadMany().
+        ///
+        /// @param requests The offsets to read and the fields to read into.
+        /// @param maxGap The largest gap between ranges to read through.
+        /// @pre The file must be opened for reading.
+        /// @pre Every request must lie entirely within the file.
+        void ReadMany(std::vector<ReadRequest> requests,
+            std::size_t maxGap = defaultReadGap) override;
+
+        /// @brief Writes the data in the field at the specified offset.
+        ///
+        /// The current offset is neither used nor changed, so several
+        /// threads may write disjoint ranges of the same open file at once.
+        /// Chunk searches must not run concurrently with writes, because a
+        /// write discards the chunk index the search may be using.
+        ///
+        /// @param offset The offset to write to.
+        /// @param f The pointer to the binary data field to write.
+        /// @pre The file must be opened for writing.
+        /// @pre The offset must be no greater than file size.
+        void WriteAt(std::size_t offset, Field* f) override;
+
         void Read(FieldStruct* s) override;
 
         void Write(FieldStruct* s) override;
 
+        /// @brief Finds the next chunk header with the specified ID.
+        ///
+        /// The first call indexes the chain of chunks that begins at the
+        /// current offset, after which lookups are served from the index
+        /// without reading from the file. The index is discarded whenever
+        /// the file is written to, opened or closed, and is rebuilt if the
+        /// search begins at an offset that is not a chunk boundary within it.
+        ///
+        /// @param ID The ID of the chunk to find.
+        /// @param endianness The endianness of the chunk sizes.
+        /// @return The chunk header, or nullptr if no chunk was found.
+        /// @post The offset is at the beginning of the chunk's payload, or
+        /// at the end of the chain if no chunk was found.
         std::shared_ptr<ChunkHeader> FindChunkHeader(std::string ID,
             BinData::Endianness endianness = BinData::Endianness::Little)
             override;
 
+        std::vector<ChunkInfo> FindChunks(std::string ID,
+            BinData::Endianness endianness = BinData::Endianness::Little)
+            override;
+
         std::string Name() const override
         {
             return mStream->FileName();
@@ -117,22 +176,73 @@ namespace BinData
         /// @brief Closes the file.
         void Close() override
         {
+            ResetChunkIndex();
             mStream->Close();
         }
 
+        /// @brief Writes any buffered data to the file without closing it.
+        void Flush() override
+        {
+            if (IsOpen())
+                mStream->Flush();
+        }
+
+        /// @brief Tells the file how it, or a range of it, is about to be
+        /// accessed. The hint is ignored if the file is not open.
+        /// @param pattern The expected access pattern.
+        /// @param offset The offset of the range the hint applies to.
+        /// @param size The size of the range, or zero for the rest of the
+        /// file.
+        void Advise(AccessPattern pattern, std::size_t offset = 0,
+            std::size_t size = 0) override
+        {
+            if (IsOpen())
+                mStream->Advise(pattern, offset, size);
+        }
+
         /// @brief Sets the offset to perform the next read or write operation
         /// @param offset The offset to start the next read or write operation
         /// @pre Offset must not be greater than equal to the file size
         void SetOffset(std::size_t offset) override;
+
+        /// @brief Enables or disables the persistent chunk index sidecar.
+        ///
+        /// When enabled, the chunk index is written to a sidecar file next
+        /// to this file (see ChunkIndexFile::SidecarName()) whenever it is
+        /// built while the file is open for reading, and is loaded again
+        /// when the file is opened, skipping the chunk scan entirely. The
+        /// sidecar is ignored if the file's size or last write time no
+        /// longer match the ones it was written for.
+        ///
+        /// @param enabled True to use the sidecar, otherwise false.
+        void UseChunkIndexFile(bool enabled)
+        {
+            mUseChunkIndexFile = enabled;
+        }
     protected:
         std::shared_ptr<FileStream> mStream;
     private:
         std::string mName;
         //std::shared_ptr<FileStream> mStream;
+        std::shared_ptr<ChunkIndex> mChunkIndex;
+        bool mUseChunkIndexFile;
 
         bool IsOpenForReading();
 
         bool IsOpenForWriting();
+
+        const ChunkIndex& IndexChunks(Endianness endianness);
+
+        void LoadChunkIndexFile();
+
+        void SaveChunkIndexFile(const ChunkIndex& index);
+
+        // The index is only ever accessed atomically, because positional
+        // writes from several threads may all drop it at once.
+        void ResetChunkIndex()
+        {
+            std::atomic_store(&mChunkIndex, std::shared_ptr<ChunkIndex>{});
+        }
     };
 }
 
@@ -0,0 +1,40 @@
+// ReadRequest.h - Declares the ReadRequest struct.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIN_DATA_READ_REQUEST_H
+#define BIN_DATA_READ_REQUEST_H
+
+#include <cstddef>
+#include "Field.h"
+
+namespace BinData
+{
+    /// @brief The largest gap between two requested ranges, in bytes, that
+    /// File::ReadMany() will read through rather than split the read.
+    constexpr std::size_t defaultReadGap{ 4096 };
+
+    /// @brief One entry in a batch of reads passed to File::ReadMany().
+    struct ReadRequest
+    {
+        /// @brief The offset to read from.
+        std::size_t offset;
+
+        /// @brief The field to read into.
+        Field* field;
+    };
+}
+
+#endif
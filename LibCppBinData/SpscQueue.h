@@ -0,0 +1,111 @@
+// SpscQueue.h - Declares the SpscQueue class template.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIN_DATA_SPSC_QUEUE_H
+#define BIN_DATA_SPSC_QUEUE_H
+
+#include <cstddef>
+#include <atomic>
+#include <vector>
+
+namespace BinData
+{
+    /// @brief A bounded, lock-free, single producer single consumer queue.
+    ///
+    /// Exactly one thread may call TryPush() and exactly one (other) thread
+    /// may call TryPop(). Neither call ever blocks or allocates; callers
+    /// that need to wait for room or for a value must arrange that
+    /// themselves.
+    ///
+    /// @tparam T The type of value the queue holds.
+    template<typename T>
+    class SpscQueue
+    {
+    public:
+        /// @brief Constructs an empty SpscQueue.
+        /// @param capacity The most values the queue can hold at once.
+        SpscQueue(std::size_t capacity)
+            : mSlots(capacity + 1), mHead{ 0 }, mTail{ 0 }
+        { }
+
+        SpscQueue(const SpscQueue&) = delete;
+
+        SpscQueue& operator=(const SpscQueue&) = delete;
+
+        /// @brief Gets the most values the queue can hold at once.
+        std::size_t Capacity() const
+        {
+            return mSlots.size() - 1;
+        }
+
+        /// @brief Determines if the queue currently holds no values.
+        bool IsEmpty() const
+        {
+            return mHead.load(std::memory_order_acquire) == 
+                mTail.load(std::memory_order_acquire);
+        }
+
+        /// @brief Adds a value to the back of the queue, if there is room.
+        /// @param value The value to add.
+        /// @return True if the value was added, false if the queue is full.
+        bool TryPush(const T& value)
+        {
+            std::size_t tail = mTail.load(std::memory_order_relaxed);
+            std::size_t next = Next(tail);
+            if (next == mHead.load(std::memory_order_acquire))
+                return false;
+            mSlots[tail] = value;
+            mTail.store(next, std::memory_order_release);
+            return true;
+        }
+
+        /// @brief Removes the value at the front of the queue, if any.
+        /// @param value Receives the value that was removed.
+        /// @return True if a value was removed, false if the queue is empty.
+        bool TryPop(T& value)
+        {
+            std::size_t head = mHead.load(std::memory_order_relaxed);
+            if (head == mTail.load(std::memory_order_acquire))
+                return false;
+            value = mSlots[head];
+            mHead.store(Next(head), std::memory_order_release);
+            return true;
+        }
+
+        /// @brief Removes every value from the queue.
+        /// @pre Neither the producer nor the consumer may be using the queue.
+        void Clear()
+        {
+            mHead.store(0, std::memory_order_relaxed);
+            mTail.store(0, std::memory_order_relaxed);
+        }
+    private:
+        // One slot always stays empty to tell a full queue from an empty one.
+        std::vector<T> mSlots;
+
+        // The producer and consumer each write one index, so keep them on
+        // separate cache lines to stop the two threads contending for one.
+        alignas(64) std::atomic<std::size_t> mHead;
+        alignas(64) std::atomic<std::size_t> mTail;
+
+        std::size_t Next(std::size_t index) const
+        {
+            return index + 1 == mSlots.size() ? 0 : index + 1;
+        }
+    };
+}
+
+#endif
@@ -14,10 +14,19 @@
 // See the License for the specific language governing permissionsand
 // limitations under the License.
 
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
 #include "StdFileStream.h"
 
 namespace BinData
 {
+    StdFileStream::~StdFileStream()
+    {
+        if (IsOpen())
+            WriteBuffered();
+    }
+
     std::size_t StdFileStream::Size() const
     {
         if (IsOpen())
@@ -32,6 +41,8 @@ namespace BinData
     {
         if (std::filesystem::exists(mFileName))
             mSize = std::filesystem::file_size(mFileName);
+        mCache.Clear();
+        mSequentialBlock = 0;
         switch (m)
         {
         case FileMode::Read:
@@ -59,22 +70,165 @@ namespace BinData
 
     void StdFileStream::Read(Field* f)
     {
-        mStream.read(f->Data(), f->Size());
-        mOffset += f->Size();
+        WriteBuffered();
+        std::size_t size = f->Size();
+        if (!mCache.IsEnabled() || size >= mCache.BlockSize() || 
+            mOffset + size > mSize)
+        {
+            // As with writes, the stream's position may be out of step.
+            if (mCache.IsEnabled() || mWriteBufferSize > 0)
+                mStream.seekg(mOffset);
+            mStream.read(f->Data(), size);
+            mOffset += size;
+            return;
+        }
+
+        // A small read may still straddle the boundary between two blocks.
+        char* destination = f->Data();
+        while (size > 0)
+        {
+            std::size_t start = mOffset % mCache.BlockSize();
+            const std::vector<char>& block = 
+                CachedBlock(mOffset / mCache.BlockSize());
+            std::size_t count = std::min(size, block.size() - start);
+            std::memcpy(destination, block.data() + start, count);
+            destination += count;
+            mOffset += count;
+            size -= count;
+        }
     }
 
     void StdFileStream::Write(Field* f)
     {
-        mStream.write(f->Data(), f->Size());
-        mOffset += f->Size();
+        std::size_t size = f->Size();
+        mCache.Invalidate(mOffset, size);
+        if (size < mWriteBufferSize)
+        {
+            if (mWriteBuffer.size() + size > mWriteBufferSize)
+                WriteBuffered();
+            if (mWriteBuffer.empty())
+                mWriteStart = mOffset;
+            mWriteBuffer.insert(mWriteBuffer.end(), f->Data(), 
+                f->Data() + size);
+        }
+        else
+        {
+            WriteBuffered();
+            WriteThrough(mOffset, f->Data(), size);
+        }
+        mOffset += size;
         if (mOffset > mSize)
             mSize = mOffset;
     }
 
     void StdFileStream::SetOffset(std::size_t o)
     {
+        // The buffer only holds one contiguous run, so it can keep growing
+        // only if the offset stays where the next write would have gone.
+        if (o != mWriteStart + mWriteBuffer.size())
+            WriteBuffered();
         mOffset = o;
-        mStream.seekg(mOffset);
+        if (!mCache.IsEnabled() && mWriteBufferSize == 0)
+            mStream.seekg(mOffset);
+    }
+
+    void StdFileStream::Flush()
+    {
+        WriteBuffered();
+        mStream.flush();
+    }
+
+    void StdFileStream::Advise(AccessPattern pattern, std::size_t offset,
+        std::size_t size)
+    {
+        std::size_t end = size == 0 ? mSize : std::min(mSize, offset + size);
+        switch (pattern)
+        {
+        case AccessPattern::WillNeed:
+        {
+            bool isReadable = 
+                mMode == FileMode::Read || mMode == FileMode::ReadWrite;
+            if (!mCache.IsEnabled() || !isReadable || offset >= end)
+                return;
+
+            // Loading more blocks than the cache holds would only evict the
+            // first of them again.
+            WriteBuffered();
+            std::size_t first = offset / mCache.BlockSize();
+            std::size_t last = (end - 1) / mCache.BlockSize();
+            last = std::min(last, first + mCache.BlockCount() - 1);
+            for (std::size_t index = first; index <= last; index++)
+            {
+                if (!mCache.Contains(index))
+                    LoadBlock(index);
+            }
+            break;
+        }
+        case AccessPattern::DontNeed:
+            if (offset < end)
+                mCache.Invalidate(offset, end - offset);
+            break;
+        default:
+            mPattern = pattern;
+            break;
+        }
+    }
+
+    void StdFileStream::WriteBuffered()
+    {
+        if (mWriteBuffer.empty())
+            return;
+        WriteThrough(mWriteStart, mWriteBuffer.data(), mWriteBuffer.size());
+        mWriteBuffer.clear();
+    }
+
+    void StdFileStream::WriteThrough(std::size_t offset, const char* data,
+        std::size_t size)
+    {
+        // The stream's position is only kept in step with the offset when
+        // every read and write goes through it, and appends ignore it.
+        bool positioned = !mCache.IsEnabled() && mWriteBufferSize == 0;
+        if (!positioned && mMode != FileMode::WriteAppend)
+            mStream.seekp(offset);
+        mStream.write(data, size);
+    }
+
+    const std::vector<char>& StdFileStream::CachedBlock(std::size_t index)
+    {
+        const std::vector<char>* cached = mCache.Find(index);
+        if (cached != nullptr)
+            return *cached;
+
+        // Missing on the block that follows the last one loaded means the 
+        // file is being read sequentially, so read the next block ahead. 
+        // That needs room for two blocks, or it would evict this one.
+        bool sequential = mPattern == AccessPattern::Sequential || 
+            (mPattern == AccessPattern::Normal && index == mSequentialBlock);
+        std::vector<char>& block = LoadBlock(index);
+        std::size_t next = index + 1;
+        if (sequential && mCache.BlockCount() > 1 && 
+            next * mCache.BlockSize() < mSize && !mCache.Contains(next))
+        {
+            LoadBlock(next);
+        }
+        return block;
+    }
+
+    std::vector<char>& StdFileStream::LoadBlock(std::size_t index)
+    {
+        std::size_t start = index * mCache.BlockSize();
+        std::size_t size = std::min(mCache.BlockSize(), mSize - start);
+        std::vector<char>& block = mCache.Insert(index, size);
+        mStream.clear();
+        mStream.seekg(start);
+        mStream.read(block.data(), size);
+        if (!mStream)
+        {
+            mCache.Invalidate(start, size);
+            throw std::runtime_error{ "Unable to read from file" };
+        }
+        mSequentialBlock = index + 1;
+        return block;
     }
 
     /*
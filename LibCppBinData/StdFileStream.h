@@ -19,21 +19,58 @@
 
 #include <fstream>
 #include <memory>
+#include <vector>
 #include "RawFile.h"
 #include "FileStream.h"
+#include "BlockCache.h"
 
 namespace BinData
 {
+    /// @brief The default size of the StdFileStream write buffer, in bytes.
+    constexpr std::size_t defaultWriteBufferSize{ 64 * 1024 };
+
+    /// @brief A FileStream that reads and writes through a std::fstream.
+    ///
+    /// Reads smaller than a block are served from an LRU cache of aligned
+    /// blocks, so parsing a file one small field at a time costs a memcpy
+    /// per field rather than a call into the stream library. When reads
+    /// miss on consecutive blocks, the block after the missed one is read
+    /// ahead as well.
+    ///
+    /// Likewise, consecutive writes smaller than the write buffer are
+    /// gathered in memory and handed to the stream as one large write when
+    /// the buffer fills, a read is made, the offset moves elsewhere, or the
+    /// stream is flushed or closed. Writes evict any cached blocks they
+    /// overlap.
     class StdFileStream : public FileStream
     {
     public:
-        StdFileStream(std::string fileName) 
+        /// @brief Constructs a StdFileStream.
+        /// @param fileName The name of the file.
+        /// @param cacheBlockSize The size of each cached block, in bytes.
+        /// @param cacheBlockCount The most blocks to cache, or zero to read
+        /// every field directly from the stream.
+        /// @param writeBufferSize The size of the write buffer, or zero to
+        /// write every field directly to the stream.
+        StdFileStream(std::string fileName, 
+            std::size_t cacheBlockSize = defaultCacheBlockSize,
+            std::size_t cacheBlockCount = defaultCacheBlockCount,
+            std::size_t writeBufferSize = defaultWriteBufferSize) 
             : mFileName{ fileName }, mStream{}, 
-            mMode{ FileMode::Read }, mSize{ 0 }, mOffset{ 0 }
+            mMode{ FileMode::Read }, mSize{ 0 }, mOffset{ 0 },
+            mCache{ cacheBlockSize, cacheBlockCount }, mSequentialBlock{ 0 },
+            mWriteBufferSize{ writeBufferSize }, mWriteStart{ 0 },
+            mPattern{ AccessPattern::Normal }
         {
 
         }
 
+        StdFileStream(const StdFileStream&) = delete;
+
+        StdFileStream& operator=(const StdFileStream&) = delete;
+
+        ~StdFileStream();
+
         std::string FileName() const override
         {
             return mFileName;
@@ -65,7 +102,9 @@ namespace BinData
 
         void Close() override
         {
+            WriteBuffered();
             mStream.close();
+            mCache.Clear();
         }
 
         void Read(Field* f) override;
@@ -73,12 +112,50 @@ namespace BinData
         void Write(Field* f) override;
 
         void SetOffset(std::size_t o) override;
+
+        /// @brief Writes the contents of the write buffer to the file.
+        void Flush() override;
+
+        /// @brief Adjusts the block cache to the access pattern.
+        ///
+        /// Sequential reads ahead on every miss and Random never does,
+        /// while Normal reads ahead once consecutive blocks miss. WillNeed
+        /// loads the blocks covering the range, up to the cache's capacity,
+        /// and DontNeed evicts them.
+        ///
+        /// @param pattern The expected access pattern.
+        /// @param offset The offset of the range the hint applies to.
+        /// @param size The size of the range, or zero for the rest of the
+        /// file.
+        void Advise(AccessPattern pattern, std::size_t offset = 0,
+            std::size_t size = 0) override;
+
+        /// @brief Gets the block cache, which reports its hits and misses.
+        const BlockCache& Cache() const
+        {
+            return mCache;
+        }
     private:
         std::string mFileName;
         std::fstream mStream;
         FileMode mMode;
         std::size_t mSize;
         std::size_t mOffset;
+        BlockCache mCache;
+        std::size_t mSequentialBlock;
+        std::size_t mWriteBufferSize;
+        std::size_t mWriteStart;
+        std::vector<char> mWriteBuffer;
+        AccessPattern mPattern;
+
+        const std::vector<char>& CachedBlock(std::size_t index);
+
+        std::vector<char>& LoadBlock(std::size_t index);
+
+        void WriteBuffered();
+
+        void WriteThrough(std::size_t offset, const char* data, 
+            std::size_t size);
     };
 
     //RawFile CreateFile(std::string fileName);
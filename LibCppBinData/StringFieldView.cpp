@@ -0,0 +1,37 @@
+// StringFieldView.cpp - Defines the StringFieldView class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "StringFieldView.h"
+
+namespace BinData
+{
+    std::string StringFieldView::ToString() const 
+    {
+        return RawFieldView::ToString(Format::Ascii);
+    }
+
+    std::string StringFieldView::ToString(Format f) const
+    {
+        return RawFieldView::ToString(f);
+    }
+
+    void StringFieldView::SetData(std::string s)
+    {
+        if (mData == nullptr)
+            throw InvalidField{ nullFieldError };
+        s.copy(mData, Size());
+    }
+}
@@ -0,0 +1,58 @@
+// StringFieldView.h - Declares the StringFieldView class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIN_DATA_STRING_FIELD_VIEW_H
+#define BIN_DATA_STRING_FIELD_VIEW_H
+
+#include <cstddef>
+#include <string>
+#include "RawFieldView.h"
+
+namespace BinData
+{
+    /// @brief A non-owning equivalent of StringField.
+    class StringFieldView : public RawFieldView
+    {
+    public:
+        /// @brief Constructs a new unbound StringFieldView.
+        /// @param size The size of the StringFieldView, in bytes.
+        /// @pre The size must be greater than or equal to minFieldSize.
+        StringFieldView(std::size_t size) : RawFieldView(size) { }
+
+        StringFieldView(char* data, std::size_t size) 
+            : RawFieldView(data, size) { }
+
+        /// @brief Gets a string representation in the default format.
+        ///
+        /// Returns a string representation of the data in the default format,
+        /// which is StringFormat::Ascii for StringFieldViews.
+        ///
+        /// @return An ASCII string representation of the data.
+        std::string ToString() const override;
+
+        std::string ToString(Format f) const override;
+
+        /// @brief Sets the bound data to the specified string.
+        ///
+        /// Behaves like StringField::SetData(), truncating the string if it
+        /// is larger than the view.
+        ///
+        /// @param s The string to copy into the bound data.
+        void SetData(std::string s);
+    };
+}
+
+#endif
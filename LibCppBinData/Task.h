@@ -0,0 +1,252 @@
+// Task.h - Declares the Task class template.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIN_DATA_TASK_H
+#define BIN_DATA_TASK_H
+
+#ifdef BIN_DATA_COROUTINES
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+namespace BinData
+{
+    /// @brief The state shared by the promises of every Task.
+    class TaskPromiseBase
+    {
+    public:
+        /// @brief Resumes whatever awaited the task once it finishes.
+        struct FinalAwaiter
+        {
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            template<typename Promise>
+            std::coroutine_handle<> await_suspend(
+                std::coroutine_handle<Promise> h) noexcept
+            {
+                std::coroutine_handle<> continuation = 
+                    h.promise().continuation;
+                if (continuation)
+                    return continuation;
+                return std::noop_coroutine();
+            }
+
+            void await_resume() const noexcept { }
+        };
+
+        /// @brief Tasks are lazy: they start when first awaited or resumed.
+        std::suspend_always initial_suspend() const noexcept
+        {
+            return {};
+        }
+
+        FinalAwaiter final_suspend() const noexcept
+        {
+            return {};
+        }
+
+        void unhandled_exception()
+        {
+            exception = std::current_exception();
+        }
+
+        /// @brief The coroutine awaiting this task, if any.
+        std::coroutine_handle<> continuation;
+
+        /// @brief The exception the task ended with, if any.
+        std::exception_ptr exception;
+    };
+
+    /// @brief A lazily started coroutine that produces a value.
+    ///
+    /// A Task is started by co_await-ing it from another coroutine, which
+    /// is resumed with the task's result (or exception) once it finishes.
+    /// Top level tasks are started by an AsyncEventLoop instead.
+    ///
+    /// @tparam ValueType The type of value the task produces.
+    template<typename ValueType>
+    class Task
+    {
+    public:
+        class promise_type : public TaskPromiseBase
+        {
+        public:
+            Task get_return_object()
+            {
+                return Task{ Handle::from_promise(*this) };
+            }
+
+            template<typename V>
+            void return_value(V&& v)
+            {
+                value.emplace(std::forward<V>(v));
+            }
+
+            std::optional<ValueType> value;
+        };
+
+        using Handle = std::coroutine_handle<promise_type>;
+
+        Task(Task&& t) noexcept : handle{ std::exchange(t.handle, nullptr) } { }
+
+        Task(const Task&) = delete;
+
+        Task& operator=(const Task&) = delete;
+
+        ~Task()
+        {
+            if (handle)
+                handle.destroy();
+        }
+
+        /// @brief Determines if the task has run to completion.
+        /// @return True if the task has finished.
+        bool IsDone() const
+        {
+            return handle && handle.done();
+        }
+
+        /// @brief Gets the task's result once it has finished.
+        /// @return The value the task produced.
+        /// @pre The task must be done.
+        ValueType& Result()
+        {
+            if (handle.promise().exception)
+                std::rethrow_exception(handle.promise().exception);
+            return *handle.promise().value;
+        }
+
+        auto operator co_await() noexcept
+        {
+            struct Awaiter
+            {
+                Handle handle;
+
+                bool await_ready() const noexcept
+                {
+                    return handle.done();
+                }
+
+                std::coroutine_handle<> await_suspend(
+                    std::coroutine_handle<> awaiting) noexcept
+                {
+                    handle.promise().continuation = awaiting;
+                    return handle;
+                }
+
+                ValueType await_resume()
+                {
+                    if (handle.promise().exception)
+                        std::rethrow_exception(handle.promise().exception);
+                    return std::move(*handle.promise().value);
+                }
+            };
+            return Awaiter{ handle };
+        }
+    private:
+        Handle handle;
+
+        explicit Task(Handle h) : handle{ h } { }
+
+        friend class AsyncEventLoop;
+    };
+
+    /// @brief A lazily started coroutine that produces no value.
+    template<>
+    class Task<void>
+    {
+    public:
+        class promise_type : public TaskPromiseBase
+        {
+        public:
+            Task get_return_object()
+            {
+                return Task{ Handle::from_promise(*this) };
+            }
+
+            void return_void() const noexcept { }
+        };
+
+        using Handle = std::coroutine_handle<promise_type>;
+
+        Task(Task&& t) noexcept : handle{ std::exchange(t.handle, nullptr) } { }
+
+        Task(const Task&) = delete;
+
+        Task& operator=(const Task&) = delete;
+
+        ~Task()
+        {
+            if (handle)
+                handle.destroy();
+        }
+
+        bool IsDone() const
+        {
+            return handle && handle.done();
+        }
+
+        /// @brief Rethrows the exception the task ended with, if any.
+        /// @pre The task must be done.
+        void Result()
+        {
+            if (handle.promise().exception)
+                std::rethrow_exception(handle.promise().exception);
+        }
+
+        auto operator co_await() noexcept
+        {
+            struct Awaiter
+            {
+                Handle handle;
+
+                bool await_ready() const noexcept
+                {
+                    return handle.done();
+                }
+
+                std::coroutine_handle<> await_suspend(
+                    std::coroutine_handle<> awaiting) noexcept
+                {
+                    handle.promise().continuation = awaiting;
+                    return handle;
+                }
+
+                void await_resume()
+                {
+                    if (handle.promise().exception)
+                        std::rethrow_exception(handle.promise().exception);
+                }
+            };
+            return Awaiter{ handle };
+        }
+    private:
+        Handle handle;
+
+        explicit Task(Handle h) : handle{ h } { }
+
+        friend class AsyncEventLoop;
+    };
+}
+
+#endif
+
+#endif
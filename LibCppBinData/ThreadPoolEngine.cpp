@@ -0,0 +1,139 @@
+// ThreadPoolEngine.cpp - Defines the ThreadPoolEngine class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cerrno>
+#include <algorithm>
+#include <unistd.h>
+#include "ThreadPoolEngine.h"
+
+namespace BinData
+{
+    ThreadPoolEngine::ThreadPoolEngine(std::size_t threadCount)
+        : mOutstanding{ 0 }, mIsStopping{ false }
+    {
+        threadCount = std::max<std::size_t>(threadCount, 1);
+        for (std::size_t i = 0; i < threadCount; i++)
+            mWorkers.emplace_back([this]() { Work(); });
+    }
+
+    ThreadPoolEngine::~ThreadPoolEngine()
+    {
+        // Workers finish every request already handed to them before they
+        // stop, as the caller's buffers must not be used after this.
+        {
+            std::lock_guard<std::mutex> lock{ mMutex };
+            mIsStopping = true;
+        }
+        mWorkReady.notify_all();
+        for (std::thread& worker : mWorkers)
+            worker.join();
+    }
+
+    void ThreadPoolEngine::Enqueue(const AsyncRequest& request)
+    {
+        mQueued.push_back(request);
+    }
+
+    std::size_t ThreadPoolEngine::Submit()
+    {
+        std::size_t count = mQueued.size();
+        if (count == 0)
+            return 0;
+
+        {
+            std::lock_guard<std::mutex> lock{ mMutex };
+            mRequests.insert(mRequests.end(), mQueued.begin(), mQueued.end());
+        }
+        mQueued.clear();
+        mOutstanding += count;
+        mWorkReady.notify_all();
+        return count;
+    }
+
+    std::size_t ThreadPoolEngine::Reap(std::vector<AsyncResult>& results,
+        std::size_t minResults)
+    {
+        Submit();
+        std::size_t target = std::min(minResults, mOutstanding);
+
+        std::unique_lock<std::mutex> lock{ mMutex };
+        mResultsReady.wait(lock, [this, target]() 
+            { 
+                return mResults.size() >= target; 
+            });
+
+        std::size_t count = mResults.size();
+        results.insert(results.end(), mResults.begin(), mResults.end());
+        mResults.clear();
+        mOutstanding -= count;
+        return count;
+    }
+
+    void ThreadPoolEngine::Work()
+    {
+        std::unique_lock<std::mutex> lock{ mMutex };
+        while (true)
+        {
+            mWorkReady.wait(lock, [this]() 
+                { 
+                    return mIsStopping || !mRequests.empty(); 
+                });
+            if (mRequests.empty())
+                return;
+
+            AsyncRequest request = mRequests.front();
+            mRequests.pop_front();
+
+            lock.unlock();
+            long result = Transfer(request);
+            lock.lock();
+
+            mResults.push_back(AsyncResult{ request.id, result });
+            mResultsReady.notify_one();
+        }
+    }
+
+    long ThreadPoolEngine::Transfer(const AsyncRequest& request)
+    {
+        // Mirror io_uring's semantics: transfer as much as possible and 
+        // report the byte count, or the negated errno if nothing was moved.
+        std::size_t done = 0;
+        while (done < request.size)
+        {
+            ssize_t count;
+            off_t offset = static_cast<off_t>(request.offset + done);
+            if (request.isWrite)
+            {
+                count = ::pwrite(request.descriptor, request.data + done,
+                    request.size - done, offset);
+            }
+            else
+            {
+                count = ::pread(request.descriptor, request.data + done,
+                    request.size - done, offset);
+            }
+
+            if (count == -1 && errno == EINTR)
+                continue;
+            if (count == -1)
+                return done > 0 ? static_cast<long>(done) : -errno;
+            if (count == 0)
+                break;
+            done += static_cast<std::size_t>(count);
+        }
+        return static_cast<long>(done);
+    }
+}
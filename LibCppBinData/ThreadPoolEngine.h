@@ -0,0 +1,79 @@
+// ThreadPoolEngine.h - Declares the ThreadPoolEngine class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIN_DATA_THREAD_POOL_ENGINE_H
+#define BIN_DATA_THREAD_POOL_ENGINE_H
+
+#include <cstddef>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "AsyncEngine.h"
+
+namespace BinData
+{
+    /// @brief An AsyncEngine that runs pread()/pwrite() on worker threads.
+    ///
+    /// This is the portable fallback for when io_uring is not available.
+    /// Each worker performs one blocking request at a time, so up to the
+    /// number of workers can be outstanding in the kernel at once.
+    ///
+    /// @remark This class is only available on POSIX platforms.
+    class ThreadPoolEngine : public AsyncEngine
+    {
+    public:
+        /// @brief Starts the worker threads.
+        /// @param threadCount The number of worker threads to start.
+        ThreadPoolEngine(std::size_t threadCount);
+
+        ThreadPoolEngine(const ThreadPoolEngine&) = delete;
+
+        ThreadPoolEngine& operator=(const ThreadPoolEngine&) = delete;
+
+        /// @brief Completes any outstanding requests and stops the workers.
+        ~ThreadPoolEngine();
+
+        void Enqueue(const AsyncRequest& request) override;
+
+        std::size_t Submit() override;
+
+        std::size_t Reap(std::vector<AsyncResult>& results,
+            std::size_t minResults) override;
+
+        std::size_t Pending() const override
+        {
+            return mQueued.size() + mOutstanding;
+        }
+    private:
+        std::vector<std::thread> mWorkers;
+        std::mutex mMutex;
+        std::condition_variable mWorkReady;
+        std::condition_variable mResultsReady;
+        std::deque<AsyncRequest> mRequests;
+        std::vector<AsyncResult> mResults;
+        std::vector<AsyncRequest> mQueued;
+        std::size_t mOutstanding;
+        bool mIsStopping;
+
+        void Work();
+
+        static long Transfer(const AsyncRequest& request);
+    };
+}
+
+#endif
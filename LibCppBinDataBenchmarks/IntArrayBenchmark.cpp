@@ -0,0 +1,137 @@
+// IntArrayBenchmark.cpp - Benchmarks the integer array conversions.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares converting a big endian table one value at a time through
+// DecodeInt(), as reading it into a FieldStruct of IntFields would, against
+// converting it with a single DecodeIntArray() call at every instruction set
+// the host supports.
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "IntConversion.h"
+#include "IntArrayConversion.h"
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr std::size_t valueCount{ 16384 };
+
+    constexpr BinData::Endianness endian{ BinData::Endianness::Big };
+
+    volatile unsigned long long sink;
+
+    template<typename Function>
+    double NanosecondsPerValue(Function convert, int iterations)
+    {
+        auto start = Clock::now();
+        for (int i = 0; i < iterations; i++)
+            convert();
+        std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+        return elapsed.count() / (static_cast<double>(iterations) * valueCount);
+    }
+
+    const char* LevelName(BinData::SimdLevel level)
+    {
+        switch (level)
+        {
+        case BinData::SimdLevel::Ssse3:
+            return "SSSE3";
+        case BinData::SimdLevel::Avx2:
+            return "AVX2";
+        case BinData::SimdLevel::Neon:
+            return "NEON";
+        default:
+            return "Scalar";
+        }
+    }
+
+    template<typename ValueType, std::size_t size>
+    bool Benchmark(const std::string& name, std::mt19937& random, 
+        int iterations)
+    {
+        std::uniform_int_distribution<int> byte{ 0, 255 };
+        std::vector<char> bytes(valueCount * size);
+        for (char& b : bytes)
+            b = static_cast<char>(byte(random));
+
+        std::vector<ValueType> expected(valueCount);
+        double perValue = NanosecondsPerValue([&]() {
+            for (std::size_t i = 0; i < valueCount; i++)
+            {
+                expected[i] = BinData::DecodeInt<ValueType, size>(
+                    bytes.data() + i * size, endian);
+            }
+            sink = static_cast<unsigned long long>(expected[0]);
+        }, iterations);
+        std::cout << std::left << std::setw(14) << name << std::setw(8) 
+            << "Value" << std::right << std::fixed << std::setprecision(3) 
+            << std::setw(10) << perValue << "\n";
+
+        bool isSame = true;
+        std::vector<ValueType> values(valueCount);
+        for (auto level : { BinData::SimdLevel::Scalar, 
+            BinData::SimdLevel::Ssse3, BinData::SimdLevel::Avx2, 
+            BinData::SimdLevel::Neon })
+        {
+            if (!BinData::SetSimdLevel(level))
+                continue;
+            double array = NanosecondsPerValue([&]() {
+                BinData::DecodeIntArray<ValueType, size>(bytes.data(), 
+                    values.data(), valueCount, endian);
+                sink = static_cast<unsigned long long>(values[0]);
+            }, iterations);
+            bool isLevelSame = values == expected;
+            isSame = isSame && isLevelSame;
+            std::cout << std::left << std::setw(14) << name << std::setw(8) 
+                << LevelName(level) << std::right << std::setw(10) << array
+                << "   " << (isLevelSame ? "same" : "DIFFERENT") << "\n";
+        }
+        BinData::SetSimdLevel(BinData::SupportedSimdLevel());
+        return isSame;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    int iterations = 2000;
+    if (argc == 3 && std::string{ argv[1] } == "--iterations")
+        iterations = std::atoi(argv[2]);
+
+    std::cout << "Nanoseconds per big endian value over " << iterations 
+        << " x " << valueCount << " values\n";
+
+    std::mt19937 random{ 42 };
+    bool isSame = true;
+    isSame &= Benchmark<std::int16_t, 2>("Int16Array", random, iterations);
+    isSame &= Benchmark<std::int32_t, 3>("Int24Array", random, iterations);
+    isSame &= Benchmark<std::uint32_t, 4>("UInt32Array", random, iterations);
+    isSame &= Benchmark<std::uint64_t, 8>("UInt64Array", random, iterations);
+
+    if (!isSame)
+    {
+        std::cerr << "The conversions produced different results\n";
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
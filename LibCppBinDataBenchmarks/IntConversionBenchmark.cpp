@@ -0,0 +1,220 @@
+// IntConversionBenchmark.cpp - Benchmarks the integer conversion functions.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares the memcpy and byte swap conversions used by DecodeInt() and
+// EncodeInt() against the original byte-by-byte conversions for every 
+// IntField alias. Each alias is first checked for identical results on
+// random data in both endiannesses, then both conversions are timed. The
+// program exits with a non-zero status if any result differs.
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "IntField.h"
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr std::size_t valueCount{ 4096 };
+
+    // Keeps the compiler from optimizing away the conversions being timed.
+    volatile unsigned long long sink;
+
+    template<typename FieldType>
+    using ValueOf = decltype(std::declval<const FieldType&>().Value());
+
+    template<typename ValueType, std::size_t size, BinData::Endianness endian>
+    ValueType DecodeReference(const char* data)
+    {
+        if constexpr (endian == BinData::Endianness::Little)
+            return BinData::ValueLEToLE<ValueType, size>(data);
+        else
+            return BinData::ValueBEToLE<ValueType, size>(data);
+    }
+
+    template<typename ValueType, std::size_t size, BinData::Endianness endian>
+    void EncodeReference(char* data, ValueType v)
+    {
+        if constexpr (endian == BinData::Endianness::Little)
+            BinData::SetValueLEToLE<ValueType, size>(data, v);
+        else
+            BinData::SetValueLEToBE<ValueType, size>(data, v);
+    }
+
+    template<typename Function>
+    double NanosecondsPerValue(Function convert, int iterations)
+    {
+        auto start = Clock::now();
+        for (int i = 0; i < iterations; i++)
+            convert();
+        std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+        return elapsed.count() / (static_cast<double>(iterations) * valueCount);
+    }
+
+    template<typename ValueType, std::size_t size, BinData::Endianness endian>
+    bool CheckParity(const std::vector<char>& bytes)
+    {
+        for (std::size_t i = 0; i < valueCount; i++)
+        {
+            const char* data = bytes.data() + i * size;
+            ValueType expected = DecodeReference<ValueType, size, endian>(data);
+            ValueType actual = BinData::DecodeInt<ValueType, size>(data, endian);
+            if (actual != expected)
+                return false;
+
+            char expectedData[size];
+            char actualData[size];
+            EncodeReference<ValueType, size, endian>(expectedData, expected);
+            BinData::EncodeInt<ValueType, size>(actualData, expected, endian);
+            if (std::memcmp(expectedData, actualData, size) != 0)
+                return false;
+        }
+        return true;
+    }
+
+    template<typename ValueType, std::size_t size, BinData::Endianness endian>
+    bool Benchmark(const std::string& name, const std::vector<char>& bytes,
+        int iterations)
+    {
+        bool isSame = CheckParity<ValueType, size, endian>(bytes);
+
+        std::vector<ValueType> values(valueCount);
+        std::vector<char> encoded(bytes.size());
+        double decodeReference = NanosecondsPerValue([&]() {
+            for (std::size_t i = 0; i < valueCount; i++)
+            {
+                values[i] = DecodeReference<ValueType, size, endian>(
+                    bytes.data() + i * size);
+            }
+            sink = static_cast<unsigned long long>(values[0]);
+        }, iterations);
+        double decode = NanosecondsPerValue([&]() {
+            for (std::size_t i = 0; i < valueCount; i++)
+            {
+                values[i] = BinData::DecodeInt<ValueType, size>(
+                    bytes.data() + i * size, endian);
+            }
+            sink = static_cast<unsigned long long>(values[0]);
+        }, iterations);
+        double encodeReference = NanosecondsPerValue([&]() {
+            for (std::size_t i = 0; i < valueCount; i++)
+            {
+                EncodeReference<ValueType, size, endian>(
+                    encoded.data() + i * size, values[i]);
+            }
+            sink = static_cast<unsigned char>(encoded[0]);
+        }, iterations);
+        double encode = NanosecondsPerValue([&]() {
+            for (std::size_t i = 0; i < valueCount; i++)
+            {
+                BinData::EncodeInt<ValueType, size>(
+                    encoded.data() + i * size, values[i], endian);
+            }
+            sink = static_cast<unsigned char>(encoded[0]);
+        }, iterations);
+
+        std::cout << std::left << std::setw(14) << name 
+            << (endian == BinData::Endianness::Little ? "LE " : "BE ")
+            << std::right << std::fixed << std::setprecision(3)
+            << std::setw(10) << decodeReference << std::setw(10) << decode
+            << std::setw(10) << encodeReference << std::setw(10) << encode
+            << "   " << (isSame ? "same" : "DIFFERENT") << "\n";
+        return isSame;
+    }
+
+    // Recovers the template arguments of an IntField alias.
+    template<typename FieldType>
+    struct IntFieldTraits;
+
+    template<typename Value, std::size_t fieldSize>
+    struct IntFieldTraits<BinData::IntField<Value, fieldSize>>
+    {
+        using ValueType = Value;
+        static constexpr std::size_t size = fieldSize;
+    };
+
+    template<typename FieldType>
+    bool BenchmarkField(const std::string& name, std::mt19937& random,
+        int iterations)
+    {
+        using ValueType = typename IntFieldTraits<FieldType>::ValueType;
+        constexpr std::size_t size = IntFieldTraits<FieldType>::size;
+
+        // Random bytes exercise both positive and negative values of every
+        // signed field along with every byte position.
+        std::uniform_int_distribution<int> byte{ 0, 255 };
+        std::vector<char> bytes(valueCount * size);
+        for (char& b : bytes)
+            b = static_cast<char>(byte(random));
+
+        bool isSame = Benchmark<ValueType, size, BinData::Endianness::Little>(
+            name, bytes, iterations);
+        return Benchmark<ValueType, size, BinData::Endianness::Big>(
+            name, bytes, iterations) && isSame;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    int iterations = 2000;
+    if (argc == 3 && std::string{ argv[1] } == "--iterations")
+        iterations = std::atoi(argv[2]);
+
+    std::cout << "Nanoseconds per value over " << iterations << " x " 
+        << valueCount << " values\n"
+        << std::left << std::setw(17) << "Field" << std::right 
+        << std::setw(10) << "DecodeRef" << std::setw(10) << "Decode"
+        << std::setw(10) << "EncodeRef" << std::setw(10) << "Encode"
+        << "   Results\n";
+
+    std::mt19937 random{ 42 };
+    bool isSame = true;
+    isSame &= BenchmarkField<BinData::UInt8Field>("UInt8Field", random, 
+        iterations);
+    isSame &= BenchmarkField<BinData::UInt16Field>("UInt16Field", random, 
+        iterations);
+    isSame &= BenchmarkField<BinData::UInt24Field>("UInt24Field", random, 
+        iterations);
+    isSame &= BenchmarkField<BinData::UInt32Field>("UInt32Field", random, 
+        iterations);
+    isSame &= BenchmarkField<BinData::UInt64Field>("UInt64Field", random, 
+        iterations);
+    isSame &= BenchmarkField<BinData::Int8Field>("Int8Field", random, 
+        iterations);
+    isSame &= BenchmarkField<BinData::Int16Field>("Int16Field", random, 
+        iterations);
+    isSame &= BenchmarkField<BinData::Int24Field>("Int24Field", random, 
+        iterations);
+    isSame &= BenchmarkField<BinData::Int32Field>("Int32Field", random, 
+        iterations);
+    isSame &= BenchmarkField<BinData::Int64Field>("Int64Field", random, 
+        iterations);
+
+    if (!isSame)
+    {
+        std::cerr << "The conversions produced different results\n";
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
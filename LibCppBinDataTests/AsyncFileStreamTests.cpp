@@ -0,0 +1,175 @@
+// AsyncFileStreamTests.cpp - Defines the AsyncFileStreamTests tests.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "AsyncFileStreamTests.h"
+
+#ifdef BIN_DATA_POSIX
+
+AsyncFileStreamTests::AsyncFileStreamTests()
+{
+    BinData::RawFile f{ "TestAsyncData" };
+    f.Open(BinData::FileMode::Write);
+    for (std::size_t i = 0; i < valueCount; i++)
+    {
+        BinData::UInt32Field value{ i * 7 };
+        f.Write(&value);
+    }
+    f.Close();
+}
+
+std::vector<BinData::AsyncCompletion> AsyncFileStreamTests::ReapAll(
+    BinData::AsyncFileStream& stream)
+{
+    std::vector<BinData::AsyncCompletion> completions;
+    while (stream.Pending() > 0)
+        stream.Reap(completions, 8);
+    return completions;
+}
+
+TEST_P(AsyncFileStreamTests, ReadsBatchesOfFields)
+{
+    // A shallow queue forces requests to be submitted and reaped while
+    // others are still being queued.
+    BinData::AsyncFileStream stream{ "TestAsyncData", GetParam(), 8 };
+    std::vector<BinData::UInt32Field> values(valueCount);
+    ASSERT_NO_THROW(stream.Open());
+    for (std::size_t i = 0; i < valueCount; i++)
+        EXPECT_EQ(stream.EnqueueRead(i * 4, &values[i]), i);
+    EXPECT_EQ(stream.Pending(), valueCount);
+
+    std::vector<BinData::AsyncCompletion> completions = ReapAll(stream);
+    ASSERT_EQ(completions.size(), valueCount);
+    for (const BinData::AsyncCompletion& completion : completions)
+    {
+        EXPECT_TRUE(completion.Succeeded());
+        EXPECT_EQ(completion.field, &values[completion.id]);
+        EXPECT_EQ(completion.offset, completion.id * 4);
+    }
+    for (std::size_t i = 0; i < valueCount; i++)
+        EXPECT_EQ(values[i].Value(), i * 7);
+    EXPECT_EQ(stream.Offset(), 0);
+}
+
+TEST_P(AsyncFileStreamTests, WritesBatchesOfFields)
+{
+    BinData::AsyncFileStream stream{ "TestAsyncData", GetParam() };
+    std::vector<BinData::UInt32Field> values;
+    for (std::size_t i = 0; i < valueCount; i++)
+        values.emplace_back(i * 11);
+
+    ASSERT_NO_THROW(stream.Open(BinData::FileMode::Write));
+    for (std::size_t i = 0; i < valueCount; i++)
+        stream.EnqueueWrite(i * 4, &values[i]);
+    EXPECT_GT(stream.Submit(), 0);
+    EXPECT_EQ(stream.Submit(), 0);
+
+    std::vector<BinData::AsyncCompletion> completions = ReapAll(stream);
+    ASSERT_EQ(completions.size(), valueCount);
+    for (const BinData::AsyncCompletion& completion : completions)
+        EXPECT_TRUE(completion.Succeeded());
+    EXPECT_EQ(stream.Size(), valueCount * 4);
+    stream.Close();
+
+    BinData::RawFile f{ "TestAsyncData" };
+    ASSERT_NO_THROW(f.Open());
+    for (std::size_t i = 0; i < valueCount; i++)
+    {
+        BinData::UInt32Field value;
+        f.Read(&value);
+        EXPECT_EQ(value.Value(), i * 11);
+    }
+}
+
+TEST_P(AsyncFileStreamTests, ReportsShortReads)
+{
+    BinData::AsyncFileStream stream{ "TestAsyncData", GetParam() };
+    BinData::UInt32Field straddling;
+    BinData::UInt32Field beyond;
+    ASSERT_NO_THROW(stream.Open());
+    stream.EnqueueRead(valueCount * 4 - 2, &straddling);
+    stream.EnqueueRead(valueCount * 4, &beyond);
+
+    std::vector<BinData::AsyncCompletion> completions = ReapAll(stream);
+    ASSERT_EQ(completions.size(), 2);
+    for (const BinData::AsyncCompletion& completion : completions)
+    {
+        EXPECT_FALSE(completion.Succeeded());
+        EXPECT_EQ(completion.error, 0);
+        EXPECT_EQ(completion.bytes, completion.id == 0 ? 2 : 0);
+    }
+}
+
+TEST_P(AsyncFileStreamTests, WorksAsFileStream)
+{
+    auto stream = std::make_shared<BinData::AsyncFileStream>(
+        "TestAsyncData", GetParam());
+    BinData::RawFile f{ stream };
+    BinData::UInt32Field value;
+    ASSERT_NO_THROW(f.Open());
+    f.SetOffset(40);
+    ASSERT_NO_THROW(f.Read(&value));
+    EXPECT_EQ(value.Value(), 70);
+    EXPECT_THROW(stream->EnqueueWrite(0, &value), std::runtime_error);
+    f.Close();
+    EXPECT_THROW(stream->EnqueueRead(0, &value), std::runtime_error);
+}
+
+TEST_P(AsyncFileStreamTests, ResolvesBackendOnOpen)
+{
+    BinData::AsyncFileStream stream{ "TestAsyncData", GetParam() };
+    ASSERT_NO_THROW(stream.Open());
+    BinData::AsyncBackend expected = BinData::AsyncBackend::ThreadPool;
+#ifdef BIN_DATA_IO_URING
+    if (GetParam() == BinData::AsyncBackend::Auto &&
+        BinData::IoUringEngine::IsSupported())
+    {
+        expected = BinData::AsyncBackend::IoUring;
+    }
+#endif
+    EXPECT_EQ(stream.Backend(), expected);
+}
+
+#ifdef BIN_DATA_IO_URING
+// Claims to be larger than a single io_uring submission can transfer, which
+// is rejected before the data is ever touched.
+class OversizedField : public BinData::Field
+{
+public:
+    char* Data() override { return &byte; }
+    std::size_t Size() const override { return std::size_t{ 1 } << 32; }
+    std::string ToString() const override { return ""; }
+    std::string ToString(BinData::Format) const override { return ""; }
+private:
+    char byte{ 0 };
+};
+
+TEST_P(AsyncFileStreamTests, RejectsOversizedIoUringRequests)
+{
+    BinData::AsyncFileStream stream{ "TestAsyncData", GetParam() };
+    ASSERT_NO_THROW(stream.Open());
+    if (stream.Backend() != BinData::AsyncBackend::IoUring)
+        GTEST_SKIP() << "io_uring is not in use";
+
+    OversizedField field;
+    EXPECT_THROW(stream.EnqueueRead(0, &field), std::runtime_error);
+    EXPECT_EQ(stream.Pending(), 0);
+}
+#endif
+
+INSTANTIATE_TEST_SUITE_P(Backends, AsyncFileStreamTests, ::testing::Values(
+    BinData::AsyncBackend::Auto, BinData::AsyncBackend::ThreadPool));
+
+#endif
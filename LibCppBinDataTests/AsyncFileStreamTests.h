@@ -0,0 +1,48 @@
+// AsyncFileStreamTests.h - Declares the AsyncFileStreamTests class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ASYNC_FILE_STREAM_TESTS_H
+#define ASYNC_FILE_STREAM_TESTS_H
+
+#ifdef BIN_DATA_POSIX
+
+#include <vector>
+#include <memory>
+#include <gtest/gtest.h>
+#include "AsyncFileStream.h"
+#include "IntField.h"
+#include "RawFile.h"
+
+#ifdef BIN_DATA_IO_URING
+#include "IoUringEngine.h"
+#endif
+
+class AsyncFileStreamTests 
+    : public ::testing::TestWithParam<BinData::AsyncBackend>
+{
+protected:
+    static constexpr std::size_t valueCount{ 512 };
+
+    AsyncFileStreamTests();
+
+    /// Reaps in small batches until nothing is left outstanding.
+    std::vector<BinData::AsyncCompletion> ReapAll(
+        BinData::AsyncFileStream& stream);
+};
+
+#endif
+
+#endif
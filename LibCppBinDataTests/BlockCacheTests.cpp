@@ -0,0 +1,128 @@
+// BlockCacheTests.cpp - Defines the BlockCacheTests class and tests.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "BlockCacheTests.h"
+
+void BlockCacheTests::AddBlock(std::size_t index)
+{
+    std::vector<char>& block = cache.Insert(index, cache.BlockSize());
+    block.assign(block.size(), static_cast<char>(index));
+}
+
+TEST_F(BlockCacheTests, FindsCachedBlocks)
+{
+    AddBlock(3);
+    const std::vector<char>* block = cache.Find(3);
+    ASSERT_NE(block, nullptr);
+    EXPECT_EQ(block->size(), 16);
+    EXPECT_EQ((*block)[0], 3);
+    EXPECT_EQ(cache.Find(4), nullptr);
+    EXPECT_EQ(cache.Hits(), 1);
+    EXPECT_EQ(cache.Misses(), 1);
+}
+
+TEST_F(BlockCacheTests, EvictsLeastRecentlyUsedBlock)
+{
+    AddBlock(0);
+    AddBlock(1);
+    ASSERT_NE(cache.Find(0), nullptr);
+    AddBlock(2);
+    EXPECT_EQ(cache.CachedBlocks(), 2);
+    EXPECT_TRUE(cache.Contains(0));
+    EXPECT_FALSE(cache.Contains(1));
+    ASSERT_NE(cache.Find(2), nullptr);
+    EXPECT_EQ((*cache.Find(2))[0], 2);
+}
+
+TEST_F(BlockCacheTests, InvalidatesOverlappingBlocks)
+{
+    AddBlock(0);
+    AddBlock(2);
+    cache.Invalidate(20, 4);
+    EXPECT_TRUE(cache.Contains(0));
+    EXPECT_TRUE(cache.Contains(2));
+    cache.Invalidate(15, 18);
+    EXPECT_FALSE(cache.Contains(0));
+    EXPECT_FALSE(cache.Contains(2));
+}
+
+TEST_F(BlockCacheTests, ServesSmallReadsFromCache)
+{
+    std::vector<std::string> IDs(64, "data");
+    WriteTestChunkFile("BlockCacheData", IDs);
+
+    // Blocks of 32 bytes hold two whole chunks, or parts of three.
+    auto stream = 
+        std::make_shared<BinData::StdFileStream>("BlockCacheData", 32, 4);
+    BinData::RawFile f{ stream };
+    ASSERT_NO_THROW(f.Open());
+    std::size_t chunkCount = 0;
+    for (const BinData::ChunkInfo& c : f.Chunks())
+    {
+        BinData::UInt32Field payload;
+        ASSERT_NO_THROW(f.Read(&payload));
+        EXPECT_EQ(payload.Value(), (chunkCount % 256) * 0x01010101);
+        chunkCount++;
+        EXPECT_EQ(c.size, 4);
+    }
+    EXPECT_EQ(chunkCount, IDs.size());
+    EXPECT_GT(stream->Cache().Hits(), stream->Cache().Misses());
+
+    // Writes must not leave stale data in the cache.
+    f.Close();
+    ASSERT_NO_THROW(f.Open(BinData::FileMode::ReadWrite));
+    BinData::UInt32Field value;
+    f.SetOffset(8);
+    ASSERT_NO_THROW(f.Read(&value));
+    EXPECT_EQ(value.Value(), 0);
+    BinData::UInt32Field replacement{ 0xAABBCCDD };
+    f.SetOffset(8);
+    ASSERT_NO_THROW(f.Write(&replacement));
+    f.SetOffset(8);
+    ASSERT_NO_THROW(f.Read(&value));
+    EXPECT_EQ(value.Value(), 0xAABBCCDD);
+    f.Close();
+}
+
+TEST_F(BlockCacheTests, FollowsAccessPatternHints)
+{
+    std::vector<std::string> IDs(64, "data");
+    WriteTestChunkFile("BlockCacheData", IDs);
+
+    auto stream = 
+        std::make_shared<BinData::StdFileStream>("BlockCacheData", 32, 8);
+    BinData::RawFile f{ stream };
+    BinData::UInt32Field value;
+    ASSERT_NO_THROW(f.Open());
+
+    // Random access never reads ahead, so each block costs a miss.
+    f.Advise(BinData::AccessPattern::Random);
+    ASSERT_NO_THROW(f.Read(&value));
+    EXPECT_EQ(stream->Cache().CachedBlocks(), 1);
+
+    // WillNeed loads the blocks up front, so reading them only hits.
+    f.Advise(BinData::AccessPattern::WillNeed, 64, 96);
+    EXPECT_EQ(stream->Cache().CachedBlocks(), 4);
+    std::size_t misses = stream->Cache().Misses();
+    f.SetOffset(12 * 7 + 8);
+    ASSERT_NO_THROW(f.Read(&value));
+    EXPECT_EQ(value.Value(), 7 * 0x01010101);
+    EXPECT_EQ(stream->Cache().Misses(), misses);
+
+    f.Advise(BinData::AccessPattern::DontNeed, 64, 32);
+    EXPECT_EQ(stream->Cache().CachedBlocks(), 3);
+    f.Close();
+}
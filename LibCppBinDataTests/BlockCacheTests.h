@@ -0,0 +1,35 @@
+// BlockCacheTests.h - Declares the BlockCacheTests class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BLOCK_CACHE_TESTS_H
+#define BLOCK_CACHE_TESTS_H
+
+#include <gtest/gtest.h>
+#include "BlockCache.h"
+#include "StdFileStream.h"
+#include "RawFile.h"
+#include "IntField.h"
+#include "TestChunkFile.h"
+
+class BlockCacheTests : public ::testing::Test
+{
+protected:
+    BinData::BlockCache cache{ 16, 2 };
+
+    void AddBlock(std::size_t index);
+};
+
+#endif
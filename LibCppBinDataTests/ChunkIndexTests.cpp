@@ -0,0 +1,193 @@
+// ChunkIndexTests.cpp - Defines the ChunkIndexTests class and tests.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ChunkIndexTests.h"
+
+ChunkIndexTests::ChunkIndexTests()
+{
+    AddChunk("fmt ", 16);
+    AddChunk("data", 100);
+    AddChunk("LIST", 26);
+    AddChunk("data", 4);
+}
+
+void ChunkIndexTests::AddChunk(std::string ID, std::size_t size)
+{
+    BinData::ChunkInfo chunk;
+    std::memcpy(chunk.id.data(), ID.data(), chunk.id.size());
+    chunk.offset = index.End();
+    chunk.size = size;
+    index.Add(chunk);
+}
+
+void ChunkIndexTests::RemoveFile(std::string fileName)
+{
+    if (std::filesystem::exists(fileName))
+        std::filesystem::remove(fileName);
+}
+
+TEST_F(ChunkIndexTests, IndexesChunksProperly)
+{
+    EXPECT_EQ(index.Start(), 12);
+    EXPECT_EQ(index.End(), 12 + 4 * 8 + 16 + 100 + 26 + 4);
+    ASSERT_EQ(index.Chunks().size(), 4);
+    EXPECT_EQ(index.Chunks()[1].ID(), "data");
+    EXPECT_EQ(index.Chunks()[1].offset, 36);
+    EXPECT_EQ(index.Chunks()[1].PayloadOffset(), 44);
+    EXPECT_TRUE(index.IsBoundary(12));
+    EXPECT_TRUE(index.IsBoundary(36));
+    EXPECT_TRUE(index.IsBoundary(index.End()));
+    EXPECT_FALSE(index.IsBoundary(44));
+    EXPECT_FALSE(index.IsBoundary(0));
+}
+
+TEST_F(ChunkIndexTests, FindsChunksByID)
+{
+    const BinData::ChunkInfo* data = index.Find("data");
+    ASSERT_NE(data, nullptr);
+    EXPECT_EQ(data->offset, 36);
+
+    const BinData::ChunkInfo* nextData = index.Find("data", 37);
+    ASSERT_NE(nextData, nullptr);
+    EXPECT_EQ(nextData->offset, 178);
+
+    EXPECT_EQ(index.Find("data", 179), nullptr);
+    EXPECT_EQ(index.Find("cue "), nullptr);
+    EXPECT_EQ(index.FindAll("data").size(), 2);
+    EXPECT_TRUE(index.FindAll("cue ").empty());
+}
+
+TEST_F(ChunkIndexTests, SavesAndLoadsSidecarProperly)
+{
+    RemoveFile("TestIndexData");
+    BinData::ChunkIndexFile indexFile{ "TestIndexData" };
+    BinData::ChunkIndexKey key{ 1234, 5678 };
+    BinData::ChunkIndexKey staleKey{ 1234, 5679 };
+
+    EXPECT_EQ(indexFile.Load(key), nullptr);
+    ASSERT_NO_THROW(indexFile.Save(index, key));
+    EXPECT_EQ(indexFile.Load(staleKey), nullptr);
+
+    std::shared_ptr<BinData::ChunkIndex> loaded = indexFile.Load(key);
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_EQ(loaded->Start(), index.Start());
+    EXPECT_EQ(loaded->End(), index.End());
+    EXPECT_EQ(loaded->Endian(), index.Endian());
+    ASSERT_EQ(loaded->Chunks().size(), index.Chunks().size());
+    for (std::size_t i = 0; i < index.Chunks().size(); i++)
+    {
+        EXPECT_EQ(loaded->Chunks()[i].ID(), index.Chunks()[i].ID());
+        EXPECT_EQ(loaded->Chunks()[i].offset, index.Chunks()[i].offset);
+        EXPECT_EQ(loaded->Chunks()[i].size, index.Chunks()[i].size);
+    }
+}
+
+TEST_F(ChunkIndexTests, RejectsSidecarWithOverflowingCount)
+{
+    RemoveFile("TestIndexData");
+    BinData::ChunkIndexFile indexFile{ "TestIndexData" };
+    BinData::ChunkIndexKey key{ 1234, 5678 };
+    ASSERT_NO_THROW(indexFile.Save(index, key));
+
+    // Patch the entry count so that multiplying it by the entry size wraps
+    // around to the size of the four entries actually in the file.
+    BinData::RawFile editor{ "TestIndexData" };
+    BinData::UInt64Field count{ (1ULL << 62) + 4 };
+    editor.Open(BinData::FileMode::ReadWrite);
+    editor.SetOffset(33);
+    editor.Write(&count);
+    editor.Close();
+
+    EXPECT_EQ(indexFile.Load(key), nullptr);
+}
+
+TEST_F(ChunkIndexTests, LeavesNoTemporaryFilesAfterSave)
+{
+    std::filesystem::path dir{ "TestIndexDir" };
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directory(dir);
+    BinData::ChunkIndexFile indexFile{ (dir / "TestIndexData").string() };
+    BinData::ChunkIndexKey key{ 1234, 5678 };
+
+    ASSERT_NO_THROW(indexFile.Save(index, key));
+    ASSERT_NO_THROW(indexFile.Save(index, key));
+
+    std::size_t files = 0;
+    for (const auto& entry : std::filesystem::directory_iterator{ dir })
+    {
+        EXPECT_EQ(entry.path().filename(), "TestIndexData");
+        files++;
+    }
+    EXPECT_EQ(files, 1);
+    EXPECT_NE(indexFile.Load(key), nullptr);
+    std::filesystem::remove_all(dir);
+}
+
+TEST_F(ChunkIndexTests, ReloadsSidecarOnOpen)
+{
+    std::string sidecar = BinData::ChunkIndexFile::SidecarName(
+        "TestChunkData");
+    RemoveFile(sidecar);
+    WriteTestChunkFile("TestChunkData", { "TST1", "TST2", "TST3" });
+
+    BinData::RawFile f{ "TestChunkData" };
+    f.UseChunkIndexFile(true);
+    f.Open();
+    ASSERT_NE(f.FindChunkHeader("TST2"), nullptr);
+    f.Close();
+    ASSERT_TRUE(std::filesystem::exists(sidecar));
+
+    // Rename the second chunk on disk without changing the file's size or
+    // write time. A file reopened with the sidecar still sees the old ID
+    // because it never scans the headers, while one without it does not.
+    auto modified = std::filesystem::last_write_time("TestChunkData");
+    BinData::RawFile editor{ "TestChunkData" };
+    BinData::StringField newID{ "XXX2", 4 };
+    editor.Open(BinData::FileMode::ReadWrite);
+    editor.SetOffset(12);
+    editor.Write(&newID);
+    editor.Close();
+    std::filesystem::last_write_time("TestChunkData", modified);
+
+    BinData::RawFile cached{ "TestChunkData" };
+    cached.UseChunkIndexFile(true);
+    cached.Open();
+    EXPECT_NE(cached.FindChunkHeader("TST2"), nullptr);
+    EXPECT_EQ(cached.Offset(), 20);
+
+    BinData::RawFile uncached{ "TestChunkData" };
+    uncached.Open();
+    EXPECT_EQ(uncached.FindChunkHeader("TST2"), nullptr);
+}
+
+TEST_F(ChunkIndexTests, IgnoresStaleSidecar)
+{
+    std::string sidecar = BinData::ChunkIndexFile::SidecarName(
+        "TestChunkData");
+    RemoveFile(sidecar);
+    WriteTestChunkFile("TestChunkData", { "TST1", "TST2" });
+
+    BinData::RawFile f{ "TestChunkData" };
+    f.UseChunkIndexFile(true);
+    f.Open();
+    ASSERT_NE(f.FindChunkHeader("TST2"), nullptr);
+    f.Close();
+
+    WriteTestChunkFile("TestChunkData", { "TST1", "TST2", "TST3" });
+    f.SetOffset(0);
+    f.Open();
+    EXPECT_NE(f.FindChunkHeader("TST3"), nullptr);
+}
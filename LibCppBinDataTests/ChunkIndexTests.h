@@ -0,0 +1,41 @@
+// ChunkIndexTests.h - Declares the ChunkIndexTests class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef CHUNK_INDEX_TESTS_H
+#define CHUNK_INDEX_TESTS_H
+
+#include <string>
+#include <cstring>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include "ChunkIndex.h"
+#include "ChunkIndexFile.h"
+#include "RawFile.h"
+#include "TestChunkFile.h"
+
+class ChunkIndexTests : public ::testing::Test
+{
+protected:
+    BinData::ChunkIndex index{ 12, BinData::Endianness::Little };
+
+    ChunkIndexTests();
+
+    void AddChunk(std::string ID, std::size_t size);
+
+    void RemoveFile(std::string fileName);
+};
+
+#endif
@@ -0,0 +1,165 @@
+// ChunkTreeTests.cpp - Defines the ChunkTreeTests class and tests.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ChunkTreeTests.h"
+
+ChunkTreeTests::ChunkTreeTests()
+{
+    // Lay out a small RIFF file with a nested LIST, two odd sized payloads
+    // that need padding and a top level chunk after the RIFF container:
+    //
+    // 0  RIFF WAVE   (66)
+    // 12   fmt       (16)
+    // 36   LIST INFO (18)
+    // 48     INAM    (5, padded)
+    // 62   data      (3, padded)
+    // 74 JUNK        (2)
+    BinData::RawFile writer{ "TestRiffData" };
+    writer.Open(BinData::FileMode::Write);
+    WriteHeader(writer, "RIFF", 66);
+    WritePayload(writer, "WAVE");
+    WriteHeader(writer, "fmt ", 16);
+    WritePayload(writer, std::string(16, 'f'));
+    WriteHeader(writer, "LIST", 18);
+    WritePayload(writer, "INFO");
+    WriteHeader(writer, "INAM", 5);
+    WritePayload(writer, "hello");
+    WriteHeader(writer, "data", 3);
+    WritePayload(writer, "abc");
+    WriteHeader(writer, "JUNK", 2);
+    WritePayload(writer, "jj");
+    writer.Close();
+}
+
+void ChunkTreeTests::WriteHeader(BinData::RawFile& f, std::string ID,
+    std::size_t size, BinData::Endianness endianness)
+{
+    BinData::ChunkHeader header{ endianness };
+    header.ID()->SetData(ID);
+    header.Size()->SetValue(size);
+    f.Write(&header);
+}
+
+void ChunkTreeTests::WritePayload(BinData::RawFile& f, std::string data)
+{
+    BinData::StringField payload{ data, data.size() };
+    f.Write(&payload);
+    if (data.size() % 2 != 0)
+    {
+        BinData::RawField padding{ 1 };
+        padding.Data()[0] = '\0';
+        f.Write(&padding);
+    }
+}
+
+TEST_F(ChunkTreeTests, BuildsNestedTreeProperly)
+{
+    ASSERT_NO_THROW(file.Open());
+    BinData::ChunkTreeWalker walker{ &file };
+    std::vector<BinData::ChunkNode> tree = walker.BuildTree();
+
+    ASSERT_EQ(tree.size(), 2);
+    const BinData::ChunkNode& riff = tree[0];
+    EXPECT_TRUE(riff.isContainer);
+    EXPECT_EQ(riff.FormType(), "WAVE");
+    ASSERT_EQ(riff.children.size(), 3);
+    EXPECT_EQ(riff.children[0].info.ID(), "fmt ");
+    EXPECT_FALSE(riff.children[0].isContainer);
+    EXPECT_EQ(riff.children[0].FormType(), "");
+
+    const BinData::ChunkNode& list = riff.children[1];
+    EXPECT_TRUE(list.isContainer);
+    EXPECT_EQ(list.FormType(), "INFO");
+    EXPECT_EQ(list.depth, 1);
+    ASSERT_EQ(list.children.size(), 1);
+    EXPECT_EQ(list.children[0].info.ID(), "INAM");
+    EXPECT_EQ(list.children[0].info.offset, 48);
+    EXPECT_EQ(list.children[0].info.size, 5);
+    EXPECT_EQ(list.children[0].depth, 2);
+
+    EXPECT_EQ(riff.children[2].info.ID(), "data");
+    EXPECT_EQ(riff.children[2].info.offset, 62);
+    EXPECT_EQ(tree[1].info.ID(), "JUNK");
+    EXPECT_EQ(tree[1].info.offset, 74);
+    EXPECT_TRUE(tree[1].children.empty());
+    EXPECT_EQ(file.Offset(), 84);
+}
+
+TEST_F(ChunkTreeTests, WalksChunksInOneForwardPass)
+{
+    ASSERT_NO_THROW(file.Open());
+    BinData::ChunkTreeWalker walker{ &file };
+    std::vector<std::string> IDs;
+    std::vector<std::size_t> depths;
+    std::size_t lastOffset = 0;
+    bool isForward = true;
+
+    walker.Walk([&](const BinData::ChunkNode& node)
+    {
+        isForward = isForward && 
+            (IDs.empty() || node.info.offset > lastOffset);
+        lastOffset = node.info.offset;
+        IDs.push_back(node.info.ID());
+        depths.push_back(node.depth);
+        EXPECT_TRUE(node.children.empty());
+    });
+
+    std::vector<std::string> expectedIDs
+    { 
+        "RIFF", "fmt ", "LIST", "INAM", "data", "JUNK" 
+    };
+    std::vector<std::size_t> expectedDepths{ 0, 1, 1, 2, 1, 0 };
+    EXPECT_EQ(IDs, expectedIDs);
+    EXPECT_EQ(depths, expectedDepths);
+    EXPECT_TRUE(isForward);
+}
+
+TEST_F(ChunkTreeTests, FindsNestedChunks)
+{
+    ASSERT_NO_THROW(file.Open());
+    BinData::ChunkTreeWalker walker{ &file };
+    std::vector<BinData::ChunkNode> tree = walker.BuildTree();
+
+    const BinData::ChunkNode* name = tree[0].Find("INAM");
+    ASSERT_NE(name, nullptr);
+    EXPECT_EQ(name->info.PayloadOffset(), 56);
+    EXPECT_EQ(tree[0].Find("JUNK"), nullptr);
+}
+
+TEST_F(ChunkTreeTests, WalksCustomContainers)
+{
+    // An IFF file uses big endian sizes and a FORM container.
+    BinData::RawFile writer{ "TestIffData" };
+    writer.Open(BinData::FileMode::Write);
+    WriteHeader(writer, "FORM", 14, BinData::Endianness::Big);
+    WritePayload(writer, "AIFF");
+    WriteHeader(writer, "COMM", 2, BinData::Endianness::Big);
+    WritePayload(writer, "cc");
+    writer.Close();
+
+    BinData::RawFile iff{ "TestIffData" };
+    ASSERT_NO_THROW(iff.Open());
+    BinData::ChunkTreeWalker walker{ &iff, BinData::Endianness::Big };
+    EXPECT_THROW(walker.AddContainerID("FRM"), BinData::InvalidFileOperation);
+    walker.AddContainerID("FORM");
+    std::vector<BinData::ChunkNode> tree = walker.BuildTree();
+
+    ASSERT_EQ(tree.size(), 1);
+    EXPECT_EQ(tree[0].FormType(), "AIFF");
+    ASSERT_EQ(tree[0].children.size(), 1);
+    EXPECT_EQ(tree[0].children[0].info.ID(), "COMM");
+    EXPECT_EQ(tree[0].children[0].info.size, 2);
+}
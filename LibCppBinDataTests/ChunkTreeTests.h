@@ -0,0 +1,41 @@
+// ChunkTreeTests.h - Declares the ChunkTreeTests class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef CHUNK_TREE_TESTS_H
+#define CHUNK_TREE_TESTS_H
+
+#include <string>
+#include <gtest/gtest.h>
+#include "ChunkTree.h"
+#include "ChunkHeader.h"
+#include "StringField.h"
+#include "RawField.h"
+#include "RawFile.h"
+
+class ChunkTreeTests : public ::testing::Test
+{
+protected:
+    BinData::RawFile file{ "TestRiffData" };
+
+    ChunkTreeTests();
+
+    void WriteHeader(BinData::RawFile& f, std::string ID, std::size_t size,
+        BinData::Endianness endianness = BinData::Endianness::Little);
+
+    void WritePayload(BinData::RawFile& f, std::string data);
+};
+
+#endif
@@ -0,0 +1,132 @@
+// CoroutineTests.cpp - Defines the CoroutineTests tests.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "CoroutineTests.h"
+
+#ifdef BIN_DATA_COROUTINES
+
+namespace
+{
+    BinData::Task<void> ReadValues(BinData::AsyncRawFile& f, 
+        std::size_t count, std::vector<unsigned long>& values)
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            BinData::UInt32Field value;
+            co_await f.ReadAsync(&value);
+            values.push_back(value.Value());
+        }
+    }
+
+    BinData::Task<void> FindChunks(BinData::AsyncRawFile& f,
+        std::vector<std::shared_ptr<BinData::ChunkHeader>>& headers)
+    {
+        headers.push_back(co_await f.FindChunkHeaderAsync("TST2"));
+        headers.push_back(co_await f.FindChunkHeaderAsync("TST1"));
+    }
+
+    BinData::Task<void> ReadStructs(BinData::AsyncRawFile& f,
+        BinData::ChunkHeader& header, BinData::PackedChunkHeader& packed)
+    {
+        co_await f.ReadAsync(&header);
+        co_await f.ReadAsync(&packed);
+    }
+}
+
+CoroutineTests::CoroutineTests()
+{
+    BinData::RawFile f{ "TestCoroutineData" };
+    f.Open(BinData::FileMode::Write);
+    for (std::size_t i = 0; i < valueCount; i++)
+    {
+        BinData::UInt32Field value{ i * 5 };
+        f.Write(&value);
+    }
+    f.Close();
+}
+
+std::unique_ptr<BinData::AsyncRawFile> CoroutineTests::OpenFile(
+    std::string fileName)
+{
+    auto stream = std::make_shared<BinData::AsyncFileStream>(fileName);
+    auto f = std::make_unique<BinData::AsyncRawFile>(stream, loop);
+    f->Open();
+    return f;
+}
+
+TEST_F(CoroutineTests, MultiplexesReadsOnOneThread)
+{
+    constexpr std::size_t fileCount{ 8 };
+    constexpr std::size_t valuesPerFile{ valueCount / fileCount };
+    std::vector<std::unique_ptr<BinData::AsyncRawFile>> files;
+    std::vector<std::vector<unsigned long>> values(fileCount);
+
+    for (std::size_t i = 0; i < fileCount; i++)
+    {
+        files.push_back(OpenFile("TestCoroutineData"));
+        files[i]->SetOffset(i * valuesPerFile * 4);
+        loop.Spawn(ReadValues(*files[i], valuesPerFile, values[i]));
+    }
+    ASSERT_NO_THROW(loop.Run());
+
+    for (std::size_t i = 0; i < fileCount; i++)
+    {
+        ASSERT_EQ(values[i].size(), valuesPerFile);
+        for (std::size_t j = 0; j < valuesPerFile; j++)
+            EXPECT_EQ(values[i][j], (i * valuesPerFile + j) * 5);
+        EXPECT_EQ(files[i]->Offset(), (i + 1) * valuesPerFile * 4);
+    }
+}
+
+TEST_F(CoroutineTests, FindsChunkHeadersAsynchronously)
+{
+    WriteTestChunkFile("TestChunkData", { "TST1", "TST2", "TST3" });
+    auto f = OpenFile("TestChunkData");
+    std::vector<std::shared_ptr<BinData::ChunkHeader>> headers;
+    loop.Spawn(FindChunks(*f, headers));
+    ASSERT_NO_THROW(loop.Run());
+
+    ASSERT_EQ(headers.size(), 2);
+    ASSERT_NE(headers[0], nullptr);
+    EXPECT_EQ(headers[0]->ID()->ToString(), "TST2");
+    EXPECT_EQ(headers[0]->Size()->Value(), 4);
+    EXPECT_EQ(headers[1], nullptr);
+    EXPECT_EQ(f->Offset(), 36);
+}
+
+TEST_F(CoroutineTests, ReadsStructsAsynchronously)
+{
+    auto f = OpenFile("TestCoroutineData");
+    BinData::ChunkHeader header;
+    BinData::PackedChunkHeader packed;
+    loop.Spawn(ReadStructs(*f, header, packed));
+    ASSERT_NO_THROW(loop.Run());
+
+    EXPECT_EQ(header.Size()->Value(), 5);
+    EXPECT_EQ(packed.Size()->Value(), 15);
+    EXPECT_EQ(f->Offset(), 16);
+}
+
+TEST_F(CoroutineTests, PropagatesExceptionsFromTasks)
+{
+    auto f = OpenFile("TestCoroutineData");
+    std::vector<unsigned long> values;
+    loop.Spawn(ReadValues(*f, valueCount + 1, values));
+    EXPECT_THROW(loop.Run(), BinData::InvalidFileOperation);
+    EXPECT_EQ(values.size(), valueCount);
+}
+
+#endif
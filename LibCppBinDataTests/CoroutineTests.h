@@ -0,0 +1,46 @@
+// CoroutineTests.h - Declares the CoroutineTests class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef COROUTINE_TESTS_H
+#define COROUTINE_TESTS_H
+
+#ifdef BIN_DATA_COROUTINES
+
+#include <vector>
+#include <memory>
+#include <gtest/gtest.h>
+#include "AsyncRawFile.h"
+#include "AsyncEventLoop.h"
+#include "IntField.h"
+#include "ChunkHeader.h"
+#include "PackedChunkHeader.h"
+#include "TestChunkFile.h"
+
+class CoroutineTests : public ::testing::Test
+{
+protected:
+    static constexpr std::size_t valueCount{ 256 };
+
+    BinData::AsyncEventLoop loop;
+
+    CoroutineTests();
+
+    std::unique_ptr<BinData::AsyncRawFile> OpenFile(std::string fileName);
+};
+
+#endif
+
+#endif
@@ -0,0 +1,81 @@
+// FieldViewTests.cpp - Defines the FieldViewTests class and tests.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FieldViewTests.h"
+
+TEST_F(FieldViewTests, CreatesUnboundViewsProperly)
+{
+    BinData::RawFieldView raw{ 4 };
+    BinData::UInt32FieldView int32;
+    EXPECT_FALSE(raw.IsBound());
+    EXPECT_FALSE(int32.IsBound());
+    EXPECT_EQ(raw.Size(), 4);
+    EXPECT_EQ(int32.Size(), 4);
+    EXPECT_EQ(raw.Data(), nullptr);
+    EXPECT_THROW(raw.ToString(), BinData::InvalidField);
+    EXPECT_THROW(int32.Value(), BinData::InvalidField);
+    EXPECT_THROW(int32.ToString(), BinData::InvalidField);
+    EXPECT_THROW(int32.ToString(BinData::Format::Hex), BinData::InvalidField);
+    EXPECT_THROW(BinData::RawFieldView{ 0 }, BinData::InvalidField);
+}
+
+TEST_F(FieldViewTests, ViewsDataWithoutCopying)
+{
+    BinData::StringFieldView id{ headerData.data(), 4 };
+    BinData::UInt32FieldView size{ headerData.data() + 4 };
+    EXPECT_EQ(id.Data(), headerData.data());
+    EXPECT_EQ(id.ToString(), "TST1");
+    EXPECT_EQ(id.ToString(BinData::Format::Hex), "54 53 54 31");
+    EXPECT_EQ(size.Value(), 42000000);
+
+    // Changes made through a view are visible in the underlying buffer.
+    size.SetValue(4);
+    EXPECT_EQ(headerData[4], 4);
+    EXPECT_EQ(headerData[5], 0);
+}
+
+TEST_F(FieldViewTests, MatchesIntFieldConversion)
+{
+    BinData::Int32Field field{ -42000000, BinData::Endianness::Big };
+    BinData::Int32FieldView view{ field.Data(), BinData::Endianness::Big };
+    EXPECT_EQ(view.Value(), field.Value());
+    EXPECT_EQ(view.ToString(), field.ToString());
+    EXPECT_EQ(view.ToString(BinData::Format::Bin), 
+        field.ToString(BinData::Format::Bin));
+    EXPECT_EQ(view.ToString(BinData::Format::Hex), 
+        field.ToString(BinData::Format::Hex));
+
+    std::stringstream viewStream;
+    std::stringstream fieldStream;
+    viewStream << view;
+    fieldStream << field;
+    EXPECT_EQ(viewStream.str(), fieldStream.str());
+    EXPECT_THROW(view.ToString(BinData::Format::Ascii), 
+        BinData::InvalidFormat);
+}
+
+TEST_F(FieldViewTests, BindsFieldStructsInPlace)
+{
+    BinData::ChunkHeaderView header;
+    ASSERT_NO_THROW(header.Bind(headerData.data()));
+    EXPECT_EQ(header.ID()->Data(), headerData.data());
+    EXPECT_EQ(header.Size()->Data(), headerData.data() + 4);
+    EXPECT_EQ(header.ID()->ToString(), "TST1");
+    EXPECT_EQ(header.Size()->Value(), 42000000);
+
+    BinData::ChunkHeader owningHeader;
+    EXPECT_THROW(owningHeader.Bind(headerData.data()), BinData::InvalidField);
+}
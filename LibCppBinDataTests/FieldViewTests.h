@@ -0,0 +1,42 @@
+// FieldViewTests.h - Declares the FieldViewTests class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef FIELD_VIEW_TESTS_H
+#define FIELD_VIEW_TESTS_H
+
+#include <vector>
+#include <sstream>
+#include <gtest/gtest.h>
+#include "RawFieldView.h"
+#include "StringFieldView.h"
+#include "IntFieldView.h"
+#include "ChunkHeader.h"
+#include "ChunkHeaderView.h"
+#include "IntField.h"
+#include "Endianness.h"
+
+class FieldViewTests : public ::testing::Test
+{
+protected:
+    // A "TST1" chunk header with a little endian size of 42000000.
+    std::vector<char> headerData
+    { 
+        'T', 'S', 'T', '1', 
+        '\x80', '\xDE', '\x80', '\x02' 
+    };
+};
+
+#endif
@@ -0,0 +1,116 @@
+// IntArrayFieldTests.cpp - Defines the IntArrayFieldTests class and tests.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <random>
+#include "IntArrayFieldTests.h"
+
+void IntArrayFieldTests::SetUp()
+{
+    std::mt19937 random{ 42 };
+    std::uniform_int_distribution<int> byte{ 0, 255 };
+    bytes.resize(count * 8);
+    for (char& b : bytes)
+        b = static_cast<char>(byte(random));
+}
+
+void IntArrayFieldTests::TearDown()
+{
+    BinData::SetSimdLevel(BinData::SupportedSimdLevel());
+}
+
+std::vector<BinData::SimdLevel> IntArrayFieldTests::SupportedLevels()
+{
+    std::vector<BinData::SimdLevel> levels;
+    for (auto level : { BinData::SimdLevel::Scalar, BinData::SimdLevel::Ssse3,
+        BinData::SimdLevel::Avx2, BinData::SimdLevel::Neon })
+    {
+        if (BinData::IsSimdLevelSupported(level))
+            levels.push_back(level);
+    }
+    return levels;
+}
+
+TEST_F(IntArrayFieldTests, SelectsSupportedSimdLevel)
+{
+    EXPECT_EQ(BinData::ActiveSimdLevel(), BinData::SupportedSimdLevel());
+    EXPECT_TRUE(BinData::IsSimdLevelSupported(BinData::SimdLevel::Scalar));
+    EXPECT_TRUE(BinData::SetSimdLevel(BinData::SimdLevel::Scalar));
+    EXPECT_EQ(BinData::ActiveSimdLevel(), BinData::SimdLevel::Scalar);
+
+    bool isX86 = BinData::IsSimdLevelSupported(BinData::SimdLevel::Ssse3);
+    bool isArm = BinData::IsSimdLevelSupported(BinData::SimdLevel::Neon);
+    EXPECT_FALSE(isX86 && isArm);
+    EXPECT_FALSE(BinData::SetSimdLevel(isArm ? 
+        BinData::SimdLevel::Avx2 : BinData::SimdLevel::Neon));
+    EXPECT_EQ(BinData::ActiveSimdLevel(), BinData::SimdLevel::Scalar);
+}
+
+TEST_F(IntArrayFieldTests, ConvertsArraysAtEverySimdLevel)
+{
+    for (auto level : SupportedLevels())
+    {
+        SCOPED_TRACE(static_cast<int>(level));
+        ASSERT_TRUE(BinData::SetSimdLevel(level));
+        ExpectMatchesScalar<std::uint8_t, 1>();
+        ExpectMatchesScalar<std::uint16_t, 2>();
+        ExpectMatchesScalar<std::int16_t, 2>();
+        ExpectMatchesScalar<std::uint32_t, 3>();
+        ExpectMatchesScalar<std::int32_t, 3>();
+        ExpectMatchesScalar<std::uint32_t, 4>();
+        ExpectMatchesScalar<std::int32_t, 4>();
+        ExpectMatchesScalar<std::uint64_t, 8>();
+        ExpectMatchesScalar<std::int64_t, 8>();
+    }
+}
+
+TEST_F(IntArrayFieldTests, SwapsBytesInPlace)
+{
+    for (auto level : SupportedLevels())
+    {
+        ASSERT_TRUE(BinData::SetSimdLevel(level));
+        std::vector<char> data{ bytes };
+        BinData::SwapBytes32(data.data(), data.data(), count);
+        for (std::size_t i = 0; i < count * 4; i++)
+            EXPECT_EQ(data[i], bytes[i / 4 * 4 + 3 - i % 4]);
+    }
+}
+
+TEST_F(IntArrayFieldTests, ReadsAndWritesValues)
+{
+    BinData::Int24ArrayField field{ 3, BinData::Endianness::Big };
+    EXPECT_EQ(field.Count(), 3);
+    EXPECT_EQ(field.Size(), 9);
+    EXPECT_EQ(field.Endian(), BinData::Endianness::Big);
+
+    std::vector<std::int32_t> values{ -420000, 420000, -1 };
+    field.SetValues(values.data());
+    EXPECT_EQ(field.Values(), values);
+    EXPECT_EQ(field.Value(0), -420000);
+    EXPECT_EQ(field.ToString(), "-420000 420000 -1");
+    EXPECT_EQ(field.ToString(BinData::Format::Hex), 
+        "F9 97 60 06 68 A0 FF FF FF");
+
+    field.SetValue(2, 8388607);
+    EXPECT_EQ(field.Value(2), 8388607);
+    EXPECT_EQ(static_cast<unsigned char>(field.Data()[6]), 0x7F);
+
+    BinData::UInt8ArrayField bytesField{ 2 };
+    bytesField.SetValue(1, 200);
+    EXPECT_EQ(bytesField.ToString(), "0 200");
+    EXPECT_THROW(bytesField.ToString(BinData::Format::Ascii), 
+        BinData::InvalidFormat);
+    EXPECT_THROW(BinData::UInt16ArrayField{ 0 }, BinData::InvalidField);
+}
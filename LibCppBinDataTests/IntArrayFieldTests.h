@@ -0,0 +1,79 @@
+// IntArrayFieldTests.h - Declares the IntArrayFieldTests class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INT_ARRAY_FIELD_TESTS_H
+#define INT_ARRAY_FIELD_TESTS_H
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "IntArrayField.h"
+#include "IntArrayConversion.h"
+#include "IntConversion.h"
+
+class IntArrayFieldTests : public ::testing::Test
+{
+protected:
+    // Long enough to run every vector kernel several times over, with an
+    // odd number of integers so the scalar tails are exercised as well.
+    static constexpr std::size_t count{ 77 };
+
+    std::vector<char> bytes;
+
+    void SetUp() override;
+
+    void TearDown() override;
+
+    /// @brief Gets every instruction set the host supports.
+    std::vector<BinData::SimdLevel> SupportedLevels();
+
+    /// @brief Checks the array conversions against IntField's conversion.
+    template<typename ValueType, std::size_t size>
+    void ExpectMatchesScalar(BinData::Endianness endian)
+    {
+        // Every buffer is exactly the size of the array, so the vector
+        // kernels reading or writing past the end show up under ASan.
+        for (std::size_t n = 1; n <= count; n++)
+        {
+            std::vector<char> source(bytes.begin(), bytes.begin() + n * size);
+            std::vector<ValueType> values(n);
+            BinData::DecodeIntArray<ValueType, size>(source.data(), 
+                values.data(), n, endian);
+            for (std::size_t i = 0; i < n; i++)
+            {
+                auto expected = BinData::DecodeInt<ValueType, size>(
+                    source.data() + i * size, endian);
+                ASSERT_EQ(values[i], expected) << "count " << n 
+                    << ", index " << i;
+            }
+
+            std::vector<char> encoded(n * size);
+            BinData::EncodeIntArray<ValueType, size>(encoded.data(), 
+                values.data(), n, endian);
+            ASSERT_EQ(encoded, source) << "count " << n;
+        }
+    }
+
+    template<typename ValueType, std::size_t size>
+    void ExpectMatchesScalar()
+    {
+        ExpectMatchesScalar<ValueType, size>(BinData::Endianness::Little);
+        ExpectMatchesScalar<ValueType, size>(BinData::Endianness::Big);
+    }
+};
+
+#endif
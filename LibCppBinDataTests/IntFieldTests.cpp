@@ -58,10 +58,8 @@ TEST_F(IntFieldTests, ConvertsToStringProperly)
 
 TEST_F(IntFieldTests, ConvertsToValueProperly)
 {
-    // Only run these tests on little-endian systems via conditional 
-    // compilation. On big endian systems, run these same tests with the
-    // vectors ending in BE (except for 8-bit fields, which are the same on
-    // either endianness).
+    // The fields default to little endian on every host, so these vectors
+    // produce the same values on big endian systems too.
     uInt8Tester.ExpectProperValue(uInt8Data, uInt8Val);
     uInt16Tester.ExpectProperValue(uInt16Data, uInt16Val);
     uInt24Tester.ExpectProperValue(uInt24Data, uInt24Val);
@@ -73,17 +71,12 @@ TEST_F(IntFieldTests, ConvertsToValueProperly)
     int24Tester.ExpectProperValue(int24Data, int24Val);
     int32Tester.ExpectProperValue(int32Data, int32Val);
     int64Tester.ExpectProperValue(int64Data, int64Val);
-
-    // TODO: Add conditional compiliation that enables these tests and
-    // disables the little endian ones on big-endian systems.
 }
 
 TEST_F(IntFieldTests, ConvertsToValueProperlyBigEndian)
 {
-    // Only run these tests on little-endian systems via conditional 
-    // compilation. On big endian systems, run these same tests with th
-    // vectors that DO NOT end in BE (except for 8-bit fields, which are the 
-    // same on either endianness).
+    // On big endian systems these fields need no byte swap at all, but the
+    // values must still come out the same.
     uInt8Tester.ExpectProperValueBE(uInt8Data, uInt8Val);
     uInt16Tester.ExpectProperValueBE(uInt16DataBE, uInt16Val);
     uInt24Tester.ExpectProperValueBE(uInt24DataBE, uInt24Val);
@@ -95,17 +88,12 @@ TEST_F(IntFieldTests, ConvertsToValueProperlyBigEndian)
     int24Tester.ExpectProperValueBE(int24DataBE, int24Val);
     int32Tester.ExpectProperValueBE(int32DataBE, int32Val);
     int64Tester.ExpectProperValueBE(int64DataBE, int64Val);
-
-    // TODO: Add conditional compiliation that enables these tests and
-    // disables the little endian ones on big-endian systems.
 }
 
 TEST_F(IntFieldTests, ConvertsToHexStringProperly)
 {
-    // Only run these tests on little-endian systems via conditional 
-    // compilation. On big endian systems, run these same tests with the
-    // vectors ending in BE (except for 8-bit fields, which are the same on
-    // either endianness).
+    // Formatting only reads the raw bytes, so the strings are the same on
+    // big endian systems.
     BinData::Format hex = BinData::Format::Hex;
 
     uInt8Tester.ExpectProperString(uInt8Data, uInt8Hex, hex);
@@ -119,9 +107,6 @@ TEST_F(IntFieldTests, ConvertsToHexStringProperly)
     int24Tester.ExpectProperString(int24Data, int24Hex, hex);
     int32Tester.ExpectProperString(int32Data, int32Hex, hex);
     int64Tester.ExpectProperString(int64Data, int64Hex, hex);
-
-    // TODO: Add conditional compiliation that enables these tests and
-    // disables the little endian ones on big-endian systems.
 }
 
 TEST_F(IntFieldTests, DoesNotAcceptAsciiFormat)
@@ -132,10 +117,8 @@ TEST_F(IntFieldTests, DoesNotAcceptAsciiFormat)
 
 TEST_F(IntFieldTests, ConvertsToBinaryStringProperly)
 {
-    // Only run these tests on little-endian systems via conditional 
-    // compilation. On big endian systems, run these same tests with the
-    // vectors ending in BE (except for 8-bit fields, which are the same on
-    // either endianness).
+    // Formatting only reads the raw bytes, so the strings are the same on
+    // big endian systems.
     BinData::Format bin = BinData::Format::Bin;
 
     uInt8Tester.ExpectProperString(uInt8Data, uInt8Bin, bin);
@@ -149,9 +132,6 @@ TEST_F(IntFieldTests, ConvertsToBinaryStringProperly)
     int24Tester.ExpectProperString(int24Data, int24Bin, bin);
     int32Tester.ExpectProperString(int32Data, int32Bin, bin);
     int64Tester.ExpectProperString(int64Data, int64Bin, bin);
-
-    // TODO: Add conditional compiliation that enables these tests and
-    // disables the little endian ones on big-endian systems.
 }
 
 TEST_F(IntFieldTests, SetsValueProperly)
@@ -227,4 +207,102 @@ TEST_F(IntFieldTests, WritesToOutputStreamProperly)
     int24Tester.ExpectWritesToStream();
     int32Tester.ExpectWritesToStream();
     int64Tester.ExpectWritesToStream();
-}
\ No newline at end of file
+}
+
+TEST_F(IntFieldTests, InlineFieldsBehaveLikeIntFields)
+{
+    uInt8InlineTester.ExpectCreatedProperly(1);
+    int16InlineTester.ExpectProperValue(int16Data, int16Val);
+    uInt24InlineTester.ExpectProperValueBE(uInt24DataBE, uInt24Val);
+    int24InlineTester.ExpectValueSetProperlyBE(int24DataBE, int24Val);
+    uInt32InlineTester.ExpectProperString(uInt32Data, uInt32Dec);
+    int64InlineTester.ExpectProperString(int64Data, int64Bin, 
+        BinData::Format::Bin);
+    int64InlineTester.ExpectValueSetProperly(int64Val);
+    uInt32InlineTester.ExpectDeepCopy();
+    int64InlineTester.ExpectWritesToStream();
+    BinData::Int32InlineField f{};
+    EXPECT_THROW(f.ToString(BinData::Format::Ascii), BinData::InvalidFormat);
+}
+
+TEST_F(IntFieldTests, InlineFieldsStoreDataInPlace)
+{
+    uInt8InlineTester.ExpectMoveKeepsData();
+    int64InlineTester.ExpectMoveKeepsData();
+
+    BinData::Int32InlineField field{ int32Val };
+    char* begin = reinterpret_cast<char*>(&field);
+    EXPECT_GE(field.Data(), begin);
+    EXPECT_LE(field.Data() + field.Size(), begin + sizeof(field));
+
+    std::vector<BinData::UInt16InlineField> fields(4);
+    for (std::size_t i = 0; i < fields.size(); i++)
+        fields[i].SetValue(uInt16Val + i);
+    for (std::size_t i = 0; i < fields.size(); i++)
+        EXPECT_EQ(fields[i].Value(), uInt16Val + i);
+}
+
+TEST_F(IntFieldTests, FixedEndianFieldsConvertProperly)
+{
+    FieldTester<BinData::UInt32LEField, unsigned long> uInt32LETester;
+    FieldTester<BinData::Int24LEField, long> int24LETester;
+    uInt32LETester.ExpectCreatedProperly(4);
+    uInt32LETester.ExpectProperValue(uInt32Data, uInt32Val);
+    int24LETester.ExpectProperValue(int24Data, int24Val);
+    int24LETester.ExpectValueSetProperly(int24Val);
+    uInt32LETester.ExpectDeepCopy();
+    uInt32LETester.ExpectWritesToStream();
+
+    FieldTester<BinData::UInt16BEField, unsigned int> uInt16BETester;
+    FieldTester<BinData::Int24BEField, long> int24BETester;
+    FieldTester<BinData::Int32BEField, long> int32BETester;
+    FieldTester<BinData::UInt64BEField, unsigned long long> uInt64BETester;
+    uInt16BETester.ExpectProperValue(uInt16DataBE, uInt16Val);
+    int24BETester.ExpectProperValue(int24DataBE, int24Val);
+    int32BETester.ExpectProperValue(int32DataBE, int32Val);
+    uInt64BETester.ExpectProperValue(uInt64DataBE, uInt64Val);
+    int32BETester.ExpectProperString(int32DataBE, int32Dec);
+    uInt64BETester.ExpectProperString(uInt64DataBE, uInt64BinBE, 
+        BinData::Format::Bin);
+
+    BinData::Int64BEField f64{ int64Val };
+    EXPECT_EQ(f64.Endian(), BinData::Endianness::Big);
+    for (std::size_t i = 0; i < f64.Size(); i++)
+        EXPECT_EQ(f64.Data()[i], static_cast<char>(int64DataBE[i]));
+    
+    BinData::UInt24BEField f24{ uInt24Val };
+    for (std::size_t i = 0; i < f24.Size(); i++)
+        EXPECT_EQ(f24.Data()[i], static_cast<char>(uInt24DataBE[i]));
+}
+
+TEST_F(IntFieldTests, ConvertsBoundaryValuesProperly)
+{
+    for (auto endian : { BinData::Endianness::Little, BinData::Endianness::Big })
+    {
+        BinData::Int24Field min24{ -8388608, endian };
+        BinData::Int24Field max24{ 8388607, endian };
+        BinData::UInt24Field umax24{ 16777215, endian };
+        BinData::Int8Field min8{ -128, endian };
+        BinData::Int64Field min64{ std::numeric_limits<long long>::min(), 
+            endian };
+        BinData::UInt64Field umax64{ 
+            std::numeric_limits<unsigned long long>::max(), endian };
+        EXPECT_EQ(min24.Value(), -8388608);
+        EXPECT_EQ(max24.Value(), 8388607);
+        EXPECT_EQ(umax24.Value(), 16777215);
+        EXPECT_EQ(min8.Value(), -128);
+        EXPECT_EQ(min64.Value(), std::numeric_limits<long long>::min());
+        EXPECT_EQ(umax64.Value(), 
+            std::numeric_limits<unsigned long long>::max());
+    }
+}
+
+TEST_F(IntFieldTests, DetectsHostEndiannessProperly)
+{
+    std::uint32_t value{ 0x01020304 };
+    unsigned char bytes[sizeof(value)];
+    std::memcpy(bytes, &value, sizeof(value));
+    auto expected = bytes[0] == 0x04 ? 
+        BinData::Endianness::Little : BinData::Endianness::Big;
+    EXPECT_EQ(BinData::hostEndianness, expected);
+}
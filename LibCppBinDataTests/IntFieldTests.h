@@ -19,10 +19,14 @@
 
 #include <gtest/gtest.h>
 #include <cstddef>
+#include <cstdint>
 #include <vector>
 #include <cstring>
 #include <string>
+#include <limits>
 #include "IntField.h"
+#include "InlineIntField.h"
+#include "FixedIntField.h"
 #include "Format.h"
 #include "Endianness.h"
 
@@ -190,6 +194,19 @@ public:
         EXPECT_EQ(f3.Value(), 42);
     }
 
+    void ExpectMoveKeepsData()
+    {
+        FieldType f1{ };
+        f1.SetValue(42);
+        FieldType f2 = FieldType(std::move(f1));
+        ASSERT_NE(f2.Data(), f1.Data());
+        EXPECT_EQ(f2.Value(), 42);
+        FieldType f3{ };
+        f3 = std::move(f2);
+        EXPECT_EQ(f3.Value(), 42);
+        EXPECT_NO_THROW(f2.Value());
+    }
+
     void ExpectWritesToStream()
     {
         FieldType f1{ };
@@ -287,6 +304,13 @@ protected:
     FieldTester<BinData::Int32Field, long> int32Tester;
     FieldTester<BinData::UInt64Field, unsigned long long> uInt64Tester;
     FieldTester<BinData::Int64Field, long long> int64Tester;
+
+    FieldTester<BinData::UInt8InlineField, unsigned int> uInt8InlineTester;
+    FieldTester<BinData::Int16InlineField, int> int16InlineTester;
+    FieldTester<BinData::UInt24InlineField, unsigned long> uInt24InlineTester;
+    FieldTester<BinData::Int24InlineField, long> int24InlineTester;
+    FieldTester<BinData::UInt32InlineField, unsigned long> uInt32InlineTester;
+    FieldTester<BinData::Int64InlineField, long long> int64InlineTester;
 };
 
 #endif
\ No newline at end of file
@@ -301,4 +301,530 @@ TEST_F(IntegrationTests, EnsuresFileIsOpenBeforeReadingOrWriting)
     FileData readData;
     EXPECT_THROW(f.Read(&readData.ui8), BinData::InvalidFileOperation);
     EXPECT_THROW(f.Write(&expectedData.ui8), BinData::InvalidFileOperation);
-}
\ No newline at end of file
+}
+
+#ifdef BIN_DATA_POSIX
+TEST_F(IntegrationTests, ReadsFileProperlyWithMmapFileStream)
+{
+    auto stream = std::make_shared<BinData::MmapFileStream>("TestReadData");
+    auto f = BinData::RawFile{ stream };
+    FileData data;
+    ASSERT_NO_THROW(f.Open());
+    ExpectAfterOpenState(f, BinData::FileMode::Read);
+    ReadFileData(f, data);
+    ExpectFileDataEQ(data, expectedData);
+    ASSERT_NO_THROW(f.Close());
+    ExpectEndOfFile(f);
+}
+
+TEST_F(IntegrationTests, WritesFileProperlyWithMmapFileStream)
+{
+    RefreshWriteDataFile();
+
+    auto stream = std::make_shared<BinData::MmapFileStream>("TestWriteData");
+    auto f = BinData::RawFile{ stream };
+    ASSERT_NO_THROW(f.Open(BinData::FileMode::Write));
+    ExpectAfterOpenState(f, BinData::FileMode::Write);
+    WriteFileData(f, expectedData);
+    ASSERT_NO_THROW(f.Close());
+    ExpectEndOfFile(f);
+
+    // Growing the mapping over-allocates, so make sure closing trimmed the
+    // file back to the data that was actually written.
+    EXPECT_EQ(std::filesystem::file_size("TestWriteData"), 47);
+
+    ASSERT_NO_THROW(f.Open(BinData::FileMode::WriteAppend));
+    WriteAppendedData(f, expectedAppend1);
+    ExpectAppendedEndOfFile(f);
+    ASSERT_NO_THROW(f.Close());
+
+    f.SetOffset(0);
+    ASSERT_NO_THROW(f.Open(BinData::FileMode::ReadWrite));
+    FileData readData;
+    AppendedData readAppend1;
+    ReadFileData(f, readData);
+    ExpectFileDataEQ(readData, expectedData);
+    ReadAppendedData(f, readAppend1);
+    ExpectAppendedDataEQ(readAppend1, expectedAppend1);
+
+    f.SetOffset(47);
+    WriteAppendedData(f, expectedAppend2);
+    f.SetOffset(47);
+    AppendedData readAppend2;
+    ReadAppendedData(f, readAppend2);
+    ExpectAppendedDataEQ(readAppend2, expectedAppend2);
+    ExpectAppendedEndOfFile(f);
+    ASSERT_NO_THROW(f.Close());
+
+    // Reading the file back through the standard stream verifies the
+    // mapped writes actually reached the file.
+    auto check = BinData::RawFile{ "TestWriteData" };
+    FileData checkData;
+    ASSERT_NO_THROW(check.Open());
+    ReadFileData(check, checkData);
+    ExpectFileDataEQ(checkData, expectedData);
+}
+
+TEST_F(IntegrationTests, BindsViewsInPlaceWithMmapFileStream)
+{
+    auto stream = std::make_shared<BinData::MmapFileStream>("TestReadData");
+    auto f = BinData::RawFile{ stream };
+    BinData::StringFieldView magicNumber{ 3 };
+    BinData::UInt24FieldView ui24;
+    ASSERT_NO_THROW(f.Open());
+    ASSERT_NO_THROW(f.Read(&magicNumber));
+    f.SetOffset(13);
+    ASSERT_NO_THROW(f.Read(&ui24));
+    EXPECT_EQ(f.Offset(), 16);
+    EXPECT_EQ(magicNumber.ToString(), expectedData.magicNumber.ToString());
+    EXPECT_EQ(ui24.Value(), expectedData.ui24.Value());
+    EXPECT_EQ(ui24.Data(), magicNumber.Data() + 13);
+}
+
+TEST_F(IntegrationTests, RejectsInvalidOperationsWithMmapFileStream)
+{
+    BinData::MmapFileStream stream{ "TestReadData" };
+    BinData::UInt8Field ui8;
+    ASSERT_NO_THROW(stream.Open());
+    EXPECT_THROW(stream.Open(), std::runtime_error);
+    EXPECT_THROW(stream.Write(&ui8), std::runtime_error);
+    EXPECT_EQ(stream.Size(), 47);
+    EXPECT_EQ(stream.Offset(), 0);
+    ASSERT_NO_THROW(stream.Close());
+
+    BinData::MmapFileStream missing{ "MissingData" };
+    EXPECT_THROW(missing.Open(), std::runtime_error);
+    EXPECT_FALSE(missing.IsOpen());
+}
+
+TEST_F(IntegrationTests, KeepsViewChangesWhenAdvisedWithMmapFileStream)
+{
+    auto stream = std::make_shared<BinData::MmapFileStream>("TestReadData");
+    auto f = BinData::RawFile{ stream };
+    BinData::UInt24FieldView ui24;
+    ASSERT_NO_THROW(f.Open());
+    f.Advise(BinData::AccessPattern::Sequential);
+    f.SetOffset(13);
+    ASSERT_NO_THROW(f.Read(&ui24));
+    ui24.SetValue(12345);
+
+    // Hints never change the data, even in a copy-on-write mapping.
+    f.Advise(BinData::AccessPattern::DontNeed);
+    f.Advise(BinData::AccessPattern::WillNeed, 7, 20);
+    EXPECT_EQ(ui24.Value(), 12345);
+    ASSERT_NO_THROW(f.Close());
+}
+
+TEST_F(IntegrationTests, ReadsFileProperlyWithPosixFileStream)
+{
+    auto stream = std::make_shared<BinData::PosixFileStream>("TestReadData");
+    auto f = BinData::RawFile{ stream };
+    FileData data;
+    ASSERT_NO_THROW(f.Open());
+    ExpectAfterOpenState(f, BinData::FileMode::Read);
+    ReadFileData(f, data);
+    ExpectFileDataEQ(data, expectedData);
+    ASSERT_NO_THROW(f.Close());
+    ExpectEndOfFile(f);
+}
+
+TEST_F(IntegrationTests, WritesFileProperlyWithPosixFileStream)
+{
+    RefreshWriteDataFile();
+
+    auto stream = std::make_shared<BinData::PosixFileStream>("TestWriteData");
+    auto f = BinData::RawFile{ stream };
+    ASSERT_NO_THROW(f.Open(BinData::FileMode::Write));
+    ExpectAfterOpenState(f, BinData::FileMode::Write);
+    WriteFileData(f, expectedData);
+    ASSERT_NO_THROW(f.Close());
+    ExpectEndOfFile(f);
+
+    ASSERT_NO_THROW(f.Open(BinData::FileMode::WriteAppend));
+    WriteAppendedData(f, expectedAppend1);
+    ExpectAppendedEndOfFile(f);
+    ASSERT_NO_THROW(f.Close());
+
+    f.SetOffset(0);
+    ASSERT_NO_THROW(f.Open(BinData::FileMode::ReadWrite));
+    FileData readData;
+    AppendedData readAppend1;
+    ReadFileData(f, readData);
+    ExpectFileDataEQ(readData, expectedData);
+    ReadAppendedData(f, readAppend1);
+    ExpectAppendedDataEQ(readAppend1, expectedAppend1);
+    ASSERT_NO_THROW(f.Close());
+}
+
+TEST_F(IntegrationTests, AccessesFileConcurrentlyWithPosixFileStream)
+{
+    constexpr std::size_t threadCount{ 8 };
+    constexpr std::size_t valuesPerThread{ 64 };
+    constexpr std::size_t valueCount{ threadCount * valuesPerThread };
+    RefreshWriteDataFile();
+
+    auto stream = std::make_shared<BinData::PosixFileStream>("TestWriteData");
+    auto f = BinData::RawFile{ stream };
+    BinData::RawField zeros{ valueCount * 4 };
+    std::memset(zeros.Data(), 0, zeros.Size());
+    ASSERT_NO_THROW(f.Open(BinData::FileMode::ReadWrite));
+    ASSERT_NO_THROW(f.Write(&zeros));
+    f.SetOffset(0);
+
+    // Each thread writes its own interleaved slots, then reads back all of
+    // them once every write has finished, without touching the offset.
+    std::vector<std::thread> writers;
+    for (std::size_t t = 0; t < threadCount; t++)
+    {
+        writers.emplace_back([&f, t]()
+        {
+            for (std::size_t i = t; i < valueCount; i += threadCount)
+            {
+                BinData::UInt32Field value{ i * 3 };
+                f.WriteAt(i * 4, &value);
+            }
+        });
+    }
+    for (std::thread& writer : writers)
+        writer.join();
+
+    std::vector<std::size_t> mismatches(threadCount, 0);
+    std::vector<std::thread> readers;
+    for (std::size_t t = 0; t < threadCount; t++)
+    {
+        readers.emplace_back([&f, &mismatches, t]()
+        {
+            for (std::size_t i = 0; i < valueCount; i++)
+            {
+                BinData::UInt32Field value;
+                f.ReadAt(i * 4, &value);
+                if (value.Value() != i * 3)
+                    mismatches[t]++;
+            }
+        });
+    }
+    for (std::thread& reader : readers)
+        reader.join();
+
+    for (std::size_t count : mismatches)
+        EXPECT_EQ(count, 0);
+    EXPECT_EQ(f.Offset(), 0);
+    EXPECT_EQ(f.Size(), valueCount * 4);
+}
+
+TEST_F(IntegrationTests, TransfersStructsWithPosixFileStream)
+{
+    RefreshWriteDataFile();
+
+    auto stream = std::make_shared<BinData::PosixFileStream>("TestWriteData");
+    auto f = BinData::RawFile{ stream };
+    BinData::ChunkHeader written;
+    written.ID()->SetData("data");
+    written.Size()->SetValue(1234);
+    ASSERT_NO_THROW(f.Open(BinData::FileMode::ReadWrite));
+    ASSERT_NO_THROW(f.Write(&written));
+    ASSERT_NO_THROW(f.Write(&written));
+    EXPECT_EQ(f.Offset(), 16);
+    EXPECT_EQ(f.Size(), 16);
+
+    BinData::ChunkHeader read;
+    f.SetOffset(8);
+    ASSERT_NO_THROW(f.Read(&read));
+    EXPECT_EQ(f.Offset(), 16);
+    EXPECT_EQ(read.ID()->ToString(), "data");
+    EXPECT_EQ(read.Size()->Value(), 1234);
+    EXPECT_THROW(f.Read(&read), BinData::InvalidFileOperation);
+    ASSERT_NO_THROW(f.Close());
+}
+
+TEST_F(IntegrationTests, RejectsSecondOpenWithPosixFileStream)
+{
+    BinData::PosixFileStream stream{ "TestReadData" };
+    ASSERT_NO_THROW(stream.Open());
+    EXPECT_THROW(stream.Open(), std::runtime_error);
+    EXPECT_TRUE(stream.IsOpen());
+    EXPECT_EQ(stream.Size(), 47);
+    ASSERT_NO_THROW(stream.Close());
+    EXPECT_FALSE(stream.IsOpen());
+}
+
+TEST_F(IntegrationTests, EnumeratesChunksWithMmapFileStream)
+{
+    WriteTestChunkFile("TestChunkData", { "TST1", "TST2", "TST3" }, 5);
+    auto stream = std::make_shared<BinData::MmapFileStream>("TestChunkData");
+    auto f = BinData::RawFile{ stream };
+    BinData::UInt8FieldView payload;
+    std::size_t count = 0;
+    ASSERT_NO_THROW(f.Open());
+    for (const BinData::ChunkInfo& chunk : f.Chunks())
+    {
+        EXPECT_EQ(chunk.offset, count * 13);
+        EXPECT_EQ(chunk.size, 5);
+        ASSERT_NO_THROW(f.Read(&payload));
+        EXPECT_EQ(payload.Value(), count);
+        count++;
+    }
+    EXPECT_EQ(count, 3);
+    EXPECT_EQ(f.Offset(), f.Size());
+}
+
+TEST_F(IntegrationTests, ReadsBulkDataWithDirectFileStream)
+{
+    constexpr std::size_t fileSize{ 3 * BinData::directAlignment + 100 };
+    RefreshWriteDataFile();
+    BinData::RawField contents{ fileSize };
+    for (std::size_t i = 0; i < fileSize; i++)
+        contents.Data()[i] = static_cast<char>(i * 7);
+    auto writer = BinData::RawFile{ "TestWriteData" };
+    ASSERT_NO_THROW(writer.Open(BinData::FileMode::Write));
+    ASSERT_NO_THROW(writer.Write(&contents));
+    ASSERT_NO_THROW(writer.Close());
+
+    // The aligned field is read in place, the unaligned one through the
+    // bounce buffer, and the small one through the page cache.
+    auto stream = std::make_shared<BinData::DirectFileStream>(
+        "TestWriteData", BinData::directAlignment);
+    auto f = BinData::RawFile{ stream };
+    BinData::RawField aligned{ fileSize, BinData::directAlignment };
+    BinData::RawField unaligned{ 2 * BinData::directAlignment + 50 };
+    BinData::UInt32Field small;
+    ASSERT_NO_THROW(f.Open());
+    ASSERT_NO_THROW(f.Read(&aligned));
+    ASSERT_NO_THROW(f.ReadAt(100, &unaligned));
+    ASSERT_NO_THROW(f.ReadAt(5000, &small));
+    EXPECT_EQ(std::memcmp(aligned.Data(), contents.Data(), fileSize), 0);
+    EXPECT_EQ(std::memcmp(unaligned.Data(), contents.Data() + 100, 
+        unaligned.Size()), 0);
+    EXPECT_EQ(std::memcmp(small.Data(), contents.Data() + 5000, 4), 0);
+    EXPECT_EQ(f.Offset(), fileSize);
+    ASSERT_NO_THROW(f.Close());
+    EXPECT_FALSE(stream->IsDirect());
+}
+#endif
+
+TEST_F(IntegrationTests, ReadsAtOffsetWithoutMovingIt)
+{
+    auto f = BinData::RawFile{ "TestReadData" };
+    BinData::UInt24Field ui24;
+    ASSERT_NO_THROW(f.Open());
+    f.SetOffset(3);
+    ASSERT_NO_THROW(f.ReadAt(13, &ui24));
+    EXPECT_EQ(f.Offset(), 3);
+    EXPECT_EQ(ui24.Value(), expectedData.ui24.Value());
+    EXPECT_THROW(f.ReadAt(f.Size() - 2, &ui24), 
+        BinData::InvalidFileOperation);
+}
+
+TEST_F(IntegrationTests, ReadsWithIndependentCursors)
+{
+    auto f = BinData::RawFile{ "TestReadData" };
+    ASSERT_NO_THROW(f.Open());
+    f.SetOffset(5);
+    BinData::FileCursor first = f.Cursor();
+    BinData::FileCursor second = f.Cursor(13);
+    BinData::StringField magicNumber{ 3 };
+    BinData::UInt24Field ui24;
+    BinData::Int24Field i24;
+
+    ASSERT_NO_THROW(second.Read(&ui24));
+    ASSERT_NO_THROW(first.Read(&magicNumber));
+    ASSERT_NO_THROW(second.Read(&i24));
+    EXPECT_EQ(magicNumber.ToString(), expectedData.magicNumber.ToString());
+    EXPECT_EQ(ui24.Value(), expectedData.ui24.Value());
+    EXPECT_EQ(i24.Value(), expectedData.i24.Value());
+    EXPECT_EQ(first.Offset(), 3);
+    EXPECT_EQ(second.Offset(), 19);
+    EXPECT_EQ(f.Offset(), 5);
+
+    // A copy picks up where the original left off, then moves on its own.
+    BinData::FileCursor copy = second;
+    copy.SetOffset(7);
+    BinData::UInt8Field ui8;
+    ASSERT_NO_THROW(copy.Read(&ui8));
+    EXPECT_EQ(ui8.Value(), expectedData.ui8.Value());
+    EXPECT_EQ(second.Offset(), 19);
+
+    BinData::UInt8FieldView unbound;
+    EXPECT_THROW(copy.Read(&unbound), BinData::InvalidFileOperation);
+    EXPECT_THROW(copy.SetOffset(f.Size() + 1), 
+        BinData::InvalidFileOperation);
+    EXPECT_THROW(f.Cursor(f.Size() + 1), BinData::InvalidFileOperation);
+}
+
+TEST_F(IntegrationTests, ReadsStructsWithCursors)
+{
+    auto f = BinData::RawFile{ "TestReadData" };
+    BinData::ChunkHeader header;
+    BinData::PackedChunkHeader packedHeader;
+    ASSERT_NO_THROW(f.Open());
+    BinData::FileCursor cursor = f.Cursor();
+    ASSERT_NO_THROW(cursor.Read(&header));
+    ASSERT_NO_THROW(cursor.Read(&packedHeader));
+    EXPECT_EQ(cursor.Offset(), 16);
+    EXPECT_EQ(header.ID()->ToString(BinData::Format::Hex), "53 4D 42 FF");
+    EXPECT_EQ(packedHeader.ID()->ToString(BinData::Format::Hex), "D6 68 10 98");
+    EXPECT_EQ(f.Offset(), 0);
+}
+
+TEST_F(IntegrationTests, ReadsIntoCallerBoundViews)
+{
+    auto f = BinData::RawFile{ "TestReadData" };
+    char buffer[8];
+    BinData::UInt8FieldView ui8{ buffer };
+    BinData::UInt8FieldView unbound;
+    ASSERT_NO_THROW(f.Open());
+    f.SetOffset(7);
+    ASSERT_NO_THROW(f.Read(&ui8));
+    EXPECT_EQ(ui8.Data(), buffer);
+    EXPECT_EQ(ui8.Value(), expectedData.ui8.Value());
+    EXPECT_THROW(f.Read(&unbound), BinData::InvalidFileOperation);
+}
+
+TEST_F(IntegrationTests, ReadsManyFieldsAtOnce)
+{
+    auto f = BinData::RawFile{ "TestReadData" };
+    ASSERT_NO_THROW(f.Open());
+    f.SetOffset(5);
+
+    // Once with every range coalesced and once with each range read alone.
+    for (std::size_t maxGap : { BinData::defaultReadGap, std::size_t{ 0 } })
+    {
+        BinData::StringField magicNumber{ 3 };
+        BinData::UInt16Field ui16;
+        BinData::UInt24Field ui24;
+        BinData::RawField overlap{ 4 };
+        BinData::Int64Field i64;
+        BinData::Int32Field i32BE{ BinData::Endianness::Big };
+        ASSERT_NO_THROW(f.ReadMany(
+        {
+            { 35, &i64 },
+            { 0, &magicNumber },
+            { 13, &ui24 },
+            { 12, &overlap },
+            { 9, &ui16 },
+            { 43, &i32BE }
+        }, maxGap));
+        EXPECT_EQ(magicNumber.ToString(), expectedData.magicNumber.ToString());
+        EXPECT_EQ(ui16.Value(), expectedData.ui16.Value());
+        EXPECT_EQ(ui24.Value(), expectedData.ui24.Value());
+        EXPECT_EQ(std::memcmp(overlap.Data() + 1, ui24.Data(), 3), 0);
+        EXPECT_EQ(i64.Value(), expectedData.i64.Value());
+        EXPECT_EQ(i32BE.Value(), expectedData.i32BE.Value());
+    }
+
+    BinData::UInt32Field pastEnd;
+    EXPECT_THROW(f.ReadMany({ { 0, &pastEnd }, { 44, &pastEnd } }), 
+        BinData::InvalidFileOperation);
+    EXPECT_EQ(f.Offset(), 5);
+}
+
+TEST_F(IntegrationTests, FlushesWhenDestroyedThroughBaseStream)
+{
+    RefreshWriteDataFile();
+    std::unique_ptr<BinData::FileStream> stream = 
+        std::make_unique<BinData::StdFileStream>("TestWriteData");
+    BinData::UInt32Field value{ 42 };
+    ASSERT_NO_THROW(stream->Open(BinData::FileMode::Write));
+    ASSERT_NO_THROW(stream->Write(&value));
+    stream.reset();
+    EXPECT_EQ(std::filesystem::file_size("TestWriteData"), 4);
+}
+
+TEST_F(IntegrationTests, BuffersSmallWritesWithStdFileStream)
+{
+    constexpr std::size_t valueCount{ 1000 };
+    RefreshWriteDataFile();
+
+    // A buffer of 64 bytes fills every 32 values.
+    auto stream = std::make_shared<BinData::StdFileStream>("TestWriteData", 
+        BinData::defaultCacheBlockSize, BinData::defaultCacheBlockCount, 64);
+    auto f = BinData::RawFile{ stream };
+    ASSERT_NO_THROW(f.Open(BinData::FileMode::Write));
+    ASSERT_NO_THROW(f.Close());
+    ASSERT_NO_THROW(f.Open(BinData::FileMode::ReadWrite));
+    for (std::size_t i = 0; i < valueCount; i++)
+    {
+        BinData::UInt16Field value{ static_cast<unsigned int>(i) };
+        ASSERT_NO_THROW(f.Write(&value));
+    }
+    EXPECT_EQ(f.Size(), valueCount * 2);
+    EXPECT_EQ(f.Offset(), valueCount * 2);
+
+    // Moving the offset back writes out the rest of the buffer first.
+    BinData::UInt16Field replacement{ 0xBEEF };
+    f.SetOffset(20);
+    ASSERT_NO_THROW(f.Write(&replacement));
+    ASSERT_NO_THROW(f.Flush());
+    EXPECT_EQ(std::filesystem::file_size("TestWriteData"), valueCount * 2);
+
+    BinData::UInt16Field value;
+    f.SetOffset(18);
+    ASSERT_NO_THROW(f.Read(&value));
+    EXPECT_EQ(value.Value(), 9);
+    ASSERT_NO_THROW(f.Read(&value));
+    EXPECT_EQ(value.Value(), 0xBEEF);
+    f.SetOffset((valueCount - 1) * 2);
+    ASSERT_NO_THROW(f.Read(&value));
+    EXPECT_EQ(value.Value(), valueCount - 1);
+    ASSERT_NO_THROW(f.Close());
+}
+
+TEST_F(IntegrationTests, WritesAndReadsWithMemoryStream)
+{
+    auto stream = std::make_shared<BinData::MemoryStream>();
+    auto f = BinData::RawFile{ stream };
+    ASSERT_NO_THROW(f.Open(BinData::FileMode::Write));
+    ExpectAfterOpenState(f, BinData::FileMode::Write);
+    WriteFileData(f, expectedData);
+    ASSERT_NO_THROW(f.Close());
+    ExpectEndOfFile(f);
+
+    ASSERT_NO_THROW(f.Open(BinData::FileMode::WriteAppend));
+    WriteAppendedData(f, expectedAppend1);
+    ExpectAppendedEndOfFile(f);
+    ASSERT_NO_THROW(f.Close());
+
+    f.SetOffset(0);
+    ASSERT_NO_THROW(f.Open());
+    FileData readData;
+    AppendedData readAppend1;
+    ReadFileData(f, readData);
+    ExpectFileDataEQ(readData, expectedData);
+    ReadAppendedData(f, readAppend1);
+    ExpectAppendedDataEQ(readAppend1, expectedAppend1);
+    EXPECT_THROW(f.Read(&readData.ui8), BinData::InvalidFileOperation);
+    ASSERT_NO_THROW(f.Close());
+    EXPECT_FALSE(std::filesystem::exists(stream->FileName()));
+}
+
+TEST_F(IntegrationTests, FindsChunksInMemorySpan)
+{
+    // Build the chunks in memory, then parse a copy of them in place.
+    auto builder = std::make_shared<BinData::MemoryStream>();
+    auto writer = BinData::RawFile{ builder };
+    ASSERT_NO_THROW(writer.Open(BinData::FileMode::Write));
+    for (std::string ID : { "TST1", "TST2", "TST3" })
+    {
+        BinData::ChunkHeader header;
+        BinData::StringField payload{ ID, 4 };
+        header.ID()->SetData(ID);
+        header.Size()->SetValue(4);
+        ASSERT_NO_THROW(writer.Write(&header));
+        ASSERT_NO_THROW(writer.Write(&payload));
+    }
+    ASSERT_NO_THROW(writer.Close());
+    std::vector<char> received(builder->Data(), 
+        builder->Data() + builder->Size());
+
+    auto stream = std::make_shared<BinData::MemoryStream>(
+        received.data(), received.size());
+    auto f = BinData::RawFile{ stream };
+    EXPECT_THROW(f.Open(BinData::FileMode::ReadWrite), std::runtime_error);
+    ASSERT_NO_THROW(f.Open());
+    ASSERT_NE(f.FindChunkHeader("TST2"), nullptr);
+    BinData::StringFieldView payload{ 4 };
+    ASSERT_NO_THROW(f.Read(&payload));
+    EXPECT_EQ(payload.ToString(), "TST2");
+    EXPECT_EQ(payload.Data(), received.data() + 20);
+    EXPECT_THROW(f.Write(&payload), BinData::InvalidFileOperation);
+}
@@ -18,13 +18,29 @@
 #define INTEGRATION_TESTS_H
 
 #include <filesystem>
+#include <thread>
+#include <vector>
+#include <cstring>
 #include <gtest/gtest.h>
 #include "File.h"
 #include "StringField.h"
+#include "StringFieldView.h"
 #include "RawField.h"
 #include "IntField.h"
+#include "IntFieldView.h"
+#include "ChunkHeaderView.h"
+#include "PackedChunkHeader.h"
+#include "FileCursor.h"
 #include "StdFileStream.h"
+#include "MemoryStream.h"
 #include "Endianness.h"
+#include "TestChunkFile.h"
+
+#ifdef BIN_DATA_POSIX
+#include "MmapFileStream.h"
+#include "PosixFileStream.h"
+#include "DirectFileStream.h"
+#endif
 
 struct FileData
 {
@@ -0,0 +1,74 @@
+// PackedFieldStructTests.cpp - Defines the PackedFieldStructTests tests.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "PackedFieldStructTests.h"
+
+using ::testing::Exactly;
+using ::testing::Return;
+using ::testing::_;
+
+TEST_F(PackedFieldStructTests, LaysOutFieldsContiguously)
+{
+    char* buffer = record.Buffer()->Data();
+    EXPECT_EQ(record.TotalSize(), 10);
+    EXPECT_EQ(record.Buffer()->Size(), 10);
+    EXPECT_EQ(record.Fields().size(), 4);
+    EXPECT_EQ(record.magicNumber->Data(), buffer);
+    EXPECT_EQ(record.ui8->Data(), buffer + 3);
+    EXPECT_EQ(record.i16->Data(), buffer + 4);
+    EXPECT_EQ(record.i32BE->Data(), buffer + 6);
+}
+
+TEST_F(PackedFieldStructTests, StoresFieldValuesInTheBuffer)
+{
+    record.magicNumber->SetData("SMB");
+    record.ui8->SetValue(42);
+    record.i16->SetValue(-4200);
+    record.i32BE->SetValue(1776);
+    EXPECT_EQ(record.Buffer()->ToString(), 
+        "53 4D 42 2A 98 EF 00 00 06 F0");
+    EXPECT_EQ(record.magicNumber->ToString(), "SMB");
+    EXPECT_EQ(record.ui8->Value(), 42);
+    EXPECT_EQ(record.i16->Value(), -4200);
+    EXPECT_EQ(record.i32BE->Value(), 1776);
+}
+
+TEST_F(PackedFieldStructTests, IsReadWithASingleStreamCall)
+{
+    auto stream = std::make_shared<MockFileStream>();
+    BinData::RawFile file{ stream };
+    BinData::PackedChunkHeader header;
+
+    EXPECT_CALL(*stream, IsOpen())
+        .WillRepeatedly(Return(true));
+    EXPECT_CALL(*stream, Mode())
+        .WillRepeatedly(Return(BinData::FileMode::Read));
+    EXPECT_CALL(*stream, Size())
+        .WillRepeatedly(Return(8));
+    EXPECT_CALL(*stream, Offset())
+        .Times(Exactly(1))
+        .WillOnce(Return(0));
+    EXPECT_CALL(*stream, Read(header.Buffer()))
+        .Times(Exactly(1))
+        .WillOnce([](BinData::Field* f)
+                  {
+                      std::memcpy(f->Data(), "TST1\x04\x00\x00\x00", 8);
+                  });
+
+    ASSERT_NO_THROW(file.Read(&header));
+    EXPECT_EQ(header.ID()->ToString(), "TST1");
+    EXPECT_EQ(header.Size()->Value(), 4);
+}
@@ -0,0 +1,52 @@
+// PackedFieldStructTests.h - Declares the PackedFieldStructTests class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef PACKED_FIELD_STRUCT_TESTS_H
+#define PACKED_FIELD_STRUCT_TESTS_H
+
+#include <memory>
+#include <gtest/gtest.h>
+#include "PackedFieldStruct.h"
+#include "PackedChunkHeader.h"
+#include "StringFieldView.h"
+#include "IntFieldView.h"
+#include "RawFile.h"
+#include "MockFileStream.h"
+
+class TestRecord : public BinData::PackedFieldStruct
+{
+public:
+    TestRecord()
+    {
+        magicNumber = AddField<BinData::StringFieldView>(3);
+        ui8 = AddField<BinData::UInt8FieldView>();
+        i16 = AddField<BinData::Int16FieldView>();
+        i32BE = AddField<BinData::Int32FieldView>(BinData::Endianness::Big);
+    }
+
+    std::shared_ptr<BinData::StringFieldView> magicNumber;
+    std::shared_ptr<BinData::UInt8FieldView> ui8;
+    std::shared_ptr<BinData::Int16FieldView> i16;
+    std::shared_ptr<BinData::Int32FieldView> i32BE;
+};
+
+class PackedFieldStructTests : public ::testing::Test
+{
+protected:
+    TestRecord record;
+};
+
+#endif
@@ -0,0 +1,96 @@
+// ParallelChunkScannerTests.cpp - Defines the ParallelChunkScannerTests tests.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ParallelChunkScannerTests.h"
+
+ParallelChunkScannerTests::ParallelChunkScannerTests()
+    : visits(chunkCount, 0)
+{
+    std::vector<std::string> IDs;
+    for (std::size_t i = 0; i < chunkCount; i++)
+        IDs.push_back(i % 2 == 0 ? "EVEN" : "ODD ");
+    WriteTestChunkFile("TestScanData", IDs, payloadSize);
+}
+
+void ParallelChunkScannerTests::Visit(const BinData::ChunkInfo& chunk, 
+    BinData::RawField* payload)
+{
+    // Every byte of a payload is its chunk's index within the file.
+    std::size_t i = chunk.offset / (BinData::chunkHeaderSize + payloadSize);
+    ASSERT_NE(payload, nullptr);
+    ASSERT_EQ(payload->Size(), payloadSize);
+    for (std::size_t j = 0; j < payloadSize; j++)
+        EXPECT_EQ(payload->Data()[j], static_cast<char>(i));
+
+    std::lock_guard<std::mutex> lock{ visitsMutex };
+    visits[i]++;
+}
+
+void ParallelChunkScannerTests::ExpectScansEveryChunk(BinData::File& f)
+{
+    BinData::ParallelChunkScanner scanner{ &f, 4 };
+    EXPECT_EQ(scanner.ThreadCount(), 4);
+    ASSERT_NO_THROW(scanner.Scan([this](const BinData::ChunkInfo& chunk, 
+        BinData::RawField* payload) { Visit(chunk, payload); }));
+
+    for (std::size_t i = 0; i < chunkCount; i++)
+        EXPECT_EQ(visits[i], 1);
+    EXPECT_EQ(f.Offset(), 0);
+}
+
+TEST_F(ParallelChunkScannerTests, ScansEveryChunkOnce)
+{
+    BinData::RawFile f{ "TestScanData" };
+    ASSERT_NO_THROW(f.Open());
+    ExpectScansEveryChunk(f);
+}
+
+#ifdef BIN_DATA_POSIX
+TEST_F(ParallelChunkScannerTests, ScansEveryChunkOnceWithMmapFileStream)
+{
+    auto stream = std::make_shared<BinData::MmapFileStream>("TestScanData");
+    BinData::RawFile f{ stream };
+    ASSERT_NO_THROW(f.Open());
+    ExpectScansEveryChunk(f);
+}
+#endif
+
+TEST_F(ParallelChunkScannerTests, ScansChunksWithID)
+{
+    BinData::RawFile f{ "TestScanData" };
+    ASSERT_NO_THROW(f.Open());
+    BinData::ParallelChunkScanner scanner{ &f, 3 };
+    ASSERT_NO_THROW(scanner.Scan("ODD ", [this](
+        const BinData::ChunkInfo& chunk, BinData::RawField* payload)
+        { Visit(chunk, payload); }));
+
+    for (std::size_t i = 0; i < chunkCount; i++)
+        EXPECT_EQ(visits[i], i % 2 == 0 ? 0 : 1);
+}
+
+TEST_F(ParallelChunkScannerTests, RethrowsCallbackExceptions)
+{
+    BinData::RawFile f{ "TestScanData" };
+    ASSERT_NO_THROW(f.Open());
+    BinData::ParallelChunkScanner scanner{ &f };
+    EXPECT_GE(scanner.ThreadCount(), 1);
+    EXPECT_THROW(scanner.Scan([](const BinData::ChunkInfo& chunk, 
+        BinData::RawField*)
+        {
+            if (chunk.offset > 0)
+                throw std::runtime_error{ "callback failed" };
+        }), std::runtime_error);
+}
@@ -0,0 +1,48 @@
+// ParallelChunkScannerTests.h - Declares the ParallelChunkScannerTests class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef PARALLEL_CHUNK_SCANNER_TESTS_H
+#define PARALLEL_CHUNK_SCANNER_TESTS_H
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <gtest/gtest.h>
+#include "ParallelChunkScanner.h"
+#include "RawFile.h"
+#include "TestChunkFile.h"
+
+#ifdef BIN_DATA_POSIX
+#include "MmapFileStream.h"
+#endif
+
+class ParallelChunkScannerTests : public ::testing::Test
+{
+protected:
+    static constexpr std::size_t chunkCount{ 200 };
+    static constexpr std::size_t payloadSize{ 16 };
+
+    std::vector<int> visits;
+    std::mutex visitsMutex;
+
+    ParallelChunkScannerTests();
+
+    void ExpectScansEveryChunk(BinData::File& f);
+
+    void Visit(const BinData::ChunkInfo& chunk, BinData::RawField* payload);
+};
+
+#endif
@@ -0,0 +1,122 @@
+// PrefetchFileStreamTests.cpp - Defines the PrefetchFileStreamTests class 
+// and tests.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "PrefetchFileStreamTests.h"
+
+#ifdef BIN_DATA_POSIX
+
+PrefetchFileStreamTests::PrefetchFileStreamTests()
+{
+    BinData::RawFile f{ "TestPrefetchData" };
+    f.Open(BinData::FileMode::Write);
+    for (std::size_t i = 0; i < valueCount; i++)
+    {
+        BinData::UInt32Field value{ i * 3 };
+        f.Write(&value);
+    }
+    f.Close();
+}
+
+TEST_F(PrefetchFileStreamTests, QueuesValuesBetweenThreads)
+{
+    BinData::SpscQueue<std::size_t> queue{ 4 };
+    EXPECT_EQ(queue.Capacity(), 4);
+    EXPECT_TRUE(queue.IsEmpty());
+
+    std::thread producer{ [&queue]()
+    {
+        for (std::size_t i = 0; i < valueCount; i++)
+        {
+            while (!queue.TryPush(i))
+                std::this_thread::yield();
+        }
+    } };
+
+    std::size_t mismatches = 0;
+    for (std::size_t i = 0; i < valueCount; i++)
+    {
+        std::size_t value;
+        while (!queue.TryPop(value))
+            std::this_thread::yield();
+        if (value != i)
+            mismatches++;
+    }
+    producer.join();
+    EXPECT_EQ(mismatches, 0);
+    EXPECT_TRUE(queue.IsEmpty());
+}
+
+TEST_F(PrefetchFileStreamTests, ReadsSequentiallyAcrossBuffers)
+{
+    // Buffers of 10 bytes leave most values straddling two buffers.
+    auto stream = std::make_shared<BinData::PrefetchFileStream>(
+        "TestPrefetchData", 10, 3);
+    BinData::RawFile f{ stream };
+    ASSERT_NO_THROW(f.Open());
+    std::size_t mismatches = 0;
+    for (std::size_t i = 0; i < valueCount; i++)
+    {
+        BinData::UInt32Field value;
+        ASSERT_NO_THROW(f.Read(&value));
+        if (value.Value() != i * 3)
+            mismatches++;
+    }
+    EXPECT_EQ(mismatches, 0);
+    EXPECT_EQ(f.Offset(), valueCount * 4);
+    ASSERT_NO_THROW(f.Close());
+}
+
+TEST_F(PrefetchFileStreamTests, RestartsWhenOffsetMoves)
+{
+    auto stream = std::make_shared<BinData::PrefetchFileStream>(
+        "TestPrefetchData", 64, 2);
+    BinData::RawFile f{ stream };
+    BinData::UInt32Field value;
+    ASSERT_NO_THROW(f.Open());
+    for (std::size_t i : { 500, 510, 502, 3, 999, 0 })
+    {
+        f.SetOffset(i * 4);
+        ASSERT_NO_THROW(f.Read(&value));
+        EXPECT_EQ(value.Value(), i * 3);
+    }
+
+    // Reading past the end is caught by RawFile, but not by the stream.
+    f.SetOffset(valueCount * 4);
+    EXPECT_THROW(stream->Read(&value), std::runtime_error);
+    f.SetOffset(4);
+    ASSERT_NO_THROW(f.Read(&value));
+    EXPECT_EQ(value.Value(), 3);
+    ASSERT_NO_THROW(f.Close());
+}
+
+TEST_F(PrefetchFileStreamTests, StopsPrefetchingOnClose)
+{
+    auto stream = std::make_shared<BinData::PrefetchFileStream>(
+        "TestPrefetchData", 16, 2);
+    BinData::RawFile f{ stream };
+    BinData::UInt32Field value;
+    ASSERT_NO_THROW(f.Open());
+    ASSERT_NO_THROW(f.Read(&value));
+    ASSERT_NO_THROW(f.Close());
+
+    // The offset survives the close, as it does for every stream.
+    ASSERT_NO_THROW(f.Open());
+    ASSERT_NO_THROW(f.Read(&value));
+    EXPECT_EQ(value.Value(), 3);
+}
+
+#endif
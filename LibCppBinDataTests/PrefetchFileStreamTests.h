@@ -0,0 +1,40 @@
+// PrefetchFileStreamTests.h - Declares the PrefetchFileStreamTests class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef PREFETCH_FILE_STREAM_TESTS_H
+#define PREFETCH_FILE_STREAM_TESTS_H
+
+#ifdef BIN_DATA_POSIX
+
+#include <thread>
+#include <memory>
+#include <gtest/gtest.h>
+#include "PrefetchFileStream.h"
+#include "SpscQueue.h"
+#include "IntField.h"
+#include "RawFile.h"
+
+class PrefetchFileStreamTests : public ::testing::Test
+{
+protected:
+    static constexpr std::size_t valueCount{ 1000 };
+
+    PrefetchFileStreamTests();
+};
+
+#endif
+
+#endif
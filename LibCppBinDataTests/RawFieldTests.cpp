@@ -52,6 +52,20 @@ TEST_F(RawFieldTests, DoesNotCreateInvalidRawField)
     ASSERT_THROW(BinData::RawField{ 0 }, BinData::InvalidField);
 }
 
+TEST_F(RawFieldTests, CreatesAlignedRawField)
+{
+    BinData::RawField f{ 10, 4096 };
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(f.Data()) % 4096, 0);
+    EXPECT_EQ(f.Alignment(), 4096);
+    EXPECT_EQ(f.Size(), 10);
+    EXPECT_EQ(f.ToString(), "00 00 00 00 00 00 00 00 00 00");
+
+    BinData::RawField copy{ f };
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(copy.Data()) % 4096, 0);
+    EXPECT_EQ(copy.Alignment(), 4096);
+    ASSERT_THROW((BinData::RawField{ 10, 3 }), BinData::InvalidField);
+}
+
 TEST_F(RawFieldTests, ConvertsToStringProperly)
 {
     EXPECT_EQ(testField->ToString(), testHexString);
@@ -19,6 +19,7 @@
 
 #include <cstring>
 #include <cstddef>
+#include <cstdint>
 #include <sstream>
 #include <vector>
 #include <memory>
@@ -14,11 +14,13 @@
 // See the License for the specific language governing permissionsand
 // limitations under the License.
 
+#include <type_traits>
 #include "RawFileTests.h"
 
 using ::testing::Exactly;
 using ::testing::Return;
 using ::testing::AtLeast;
+using ::testing::AnyNumber;
 using ::testing::InSequence;
 using ::testing::_;
 using namespace BinData;
@@ -48,6 +50,47 @@ void RawFileTests::ExpectOpened(BinData::FileMode m)
     EXPECT_EQ(testFile->Mode(), m);
 }
 
+void RawFileTests::ExpectChunkedStream(std::vector<std::string> IDs)
+{
+    // Lay out a chunk with a 4 byte payload for each ID and have the mock
+    // stream serve reads from it, tracking its own offset.
+    chunkData.clear();
+    for (const std::string& ID : IDs)
+    {
+        StringField id{ ID, 4 };
+        UInt32Field size{ 4 };
+        chunkData.insert(chunkData.end(), id.Data(), id.Data() + 4);
+        chunkData.insert(chunkData.end(), size.Data(), size.Data() + 4);
+        chunkData.insert(chunkData.end(), 4, '\0');
+    }
+    chunkOffset = 0;
+
+    EXPECT_CALL(*mockStream, IsOpen())
+        .WillOnce(Return(false))
+        .WillRepeatedly(Return(true));
+    EXPECT_CALL(*mockStream, Exists)
+        .WillRepeatedly(Return(true));
+    EXPECT_CALL(*mockStream, Open(BinData::FileMode::Read))
+        .Times(Exactly(1));
+    EXPECT_CALL(*mockStream, Mode())
+        .WillRepeatedly(Return(BinData::FileMode::Read));
+    EXPECT_CALL(*mockStream, Size())
+        .WillRepeatedly([this]() { return chunkData.size(); });
+    EXPECT_CALL(*mockStream, Offset())
+        .WillRepeatedly([this]() { return chunkOffset; });
+    EXPECT_CALL(*mockStream, SetOffset(_))
+        .WillRepeatedly([this](std::size_t o) { chunkOffset = o; });
+    ON_CALL(*mockStream, Read(_))
+        .WillByDefault([this](Field* f)
+                       {
+                           std::memcpy(f->Data(), 
+                               chunkData.data() + chunkOffset, f->Size());
+                           chunkOffset += f->Size();
+                       });
+    EXPECT_CALL(*mockStream, Read(_))
+        .Times(AnyNumber());
+}
+
 void RawFileTests::ExpectOpensAndClosesProperly(BinData::FileMode m)
 {
     InitializeTestFile();
@@ -101,6 +144,13 @@ TEST_F(RawFileTests, CreatesFileProperly)
     EXPECT_EQ(testFile->Offset(), 0);
 }
 
+TEST_F(RawFileTests, CanBeCopiedAndMoved)
+{
+    EXPECT_TRUE(std::is_copy_constructible_v<BinData::RawFile>);
+    EXPECT_TRUE(std::is_move_constructible_v<BinData::RawFile>);
+    EXPECT_TRUE(std::is_move_assignable_v<BinData::RawFile>);
+}
+
 TEST_F(RawFileTests, DoesNotCreateInvalidFile)
 {
     std::shared_ptr<BinData::FileStream> nullStream = nullptr;
@@ -254,8 +304,7 @@ TEST_F(RawFileTests, ReadsFieldStructsProperly)
         .Times(AtLeast(1))
         .WillRepeatedly(Return(fields));
     EXPECT_CALL(*mockStream, Offset())
-        .WillOnce(Return(0))
-        .WillOnce(Return(4));
+        .WillOnce(Return(0));
     EXPECT_CALL(*mockStream, Read(field1.get()))
         .Times(Exactly(1));
     EXPECT_CALL(*mockStream, Read(field2.get()))
@@ -293,8 +342,7 @@ TEST_F(RawFileTests, WritesFieldStructProperly)
         .Times(AtLeast(1))
         .WillRepeatedly(Return(fields));
     EXPECT_CALL(*mockStream, Offset())
-        .WillOnce(Return(0))
-        .WillOnce(Return(4));
+        .WillOnce(Return(0));
     {
         InSequence seq;
         EXPECT_CALL(*mockStream, Write(field1.get()))
@@ -309,72 +357,52 @@ TEST_F(RawFileTests, WritesFieldStructProperly)
 TEST_F(RawFileTests, FindsChunkHeaderProperly)
 {
     InitializeTestFile();
+    ExpectChunkedStream();
 
-    /*
-    ChunkHeader header1;
-    header1.ID()->SetData("TST1");
-    header1.Size()->SetValue(4);
-    MockField data1;
+    ASSERT_NO_THROW(testFile->Open(BinData::FileMode::Read));
+    
+    std::shared_ptr<ChunkHeader> header = testFile->FindChunkHeader("TST2");
+    ASSERT_NE(header, nullptr);
+    EXPECT_EQ(header->ID()->ToString(), "TST2");
+    EXPECT_EQ(header->Size()->Value(), 4);
+    EXPECT_EQ(testFile->Offset(), 20);
+}
 
-    ChunkHeader header2;
-    header2.ID()->SetData("TST2");
-    header2.Size()->SetValue(4);
-    MockField data2;
+TEST_F(RawFileTests, ReusesChunkIndexForRepeatedSearches)
+{
+    InitializeTestFile();
+    ExpectChunkedStream();
 
-    ChunkHeader header3;
-    header3.ID()->SetData("TST3");
-    header3.Size()->SetValue(4);
-    MockField data3;*/
+    // Indexing the three chunks reads each header exactly once, and no
+    // further reads are needed for the searches that follow.
+    EXPECT_CALL(*mockStream, Read(_))
+        .Times(Exactly(3));
 
-    EXPECT_CALL(*mockStream, IsOpen())
-        .WillOnce(Return(false))
-        .WillRepeatedly(Return(true));
-    EXPECT_CALL(*mockStream, Exists)
-        .WillRepeatedly(Return(true));
-    EXPECT_CALL(*mockStream, Open(BinData::FileMode::Read))
-        .Times(Exactly(1));
-    EXPECT_CALL(*mockStream, Mode())
-        .Times(AtLeast(1))
-        .WillRepeatedly(Return(BinData::FileMode::Read));
-    EXPECT_CALL(*mockStream, Size())
-        .Times(AtLeast(1))
-        .WillRepeatedly(Return(36));
+    ASSERT_NO_THROW(testFile->Open(BinData::FileMode::Read));
+    ASSERT_NE(testFile->FindChunkHeader("TST3"), nullptr);
+    EXPECT_EQ(testFile->Offset(), 32);
+    testFile->SetOffset(0);
+    ASSERT_NE(testFile->FindChunkHeader("TST1"), nullptr);
+    EXPECT_EQ(testFile->Offset(), 8);
+    testFile->SetOffset(12);
+    EXPECT_EQ(testFile->FindChunkHeader("TST1"), nullptr);
+    EXPECT_EQ(testFile->Offset(), 36);
+}
 
-    EXPECT_CALL(*mockStream, Offset())
-        .WillOnce(Return(0))   // AtTheEnd()
-        .WillOnce(Return(0))   // Read() for ID, advances offset
-        .WillOnce(Return(4))   // Read() for Size, advances offset
-        .WillOnce(Return(8))   // Offset() for calcuating next offset
-        .WillOnce(Return(12))  // AtTheEnd(), assumes SetOffset skiped 4 bytes
-        .WillOnce(Return(12))  // Read() for ID, advances offset
-        .WillOnce(Return(16)); // Read() for Size, advances offset
-    EXPECT_CALL(*mockStream, Read(_))
-        .WillOnce([](Field* f)
-                  {  
-                      StringField s{ "TST1", 4 };
-                      std::memcpy(f->Data(), s.Data(), s.Size());
-                  })
-        .WillOnce([](Field* f)
-                  {  
-                      UInt32Field i{ 4 };
-                      std::memcpy(f->Data(), i.Data(), i.Size());
-                  })
-        .WillOnce([](Field* f)
-                  {  
-                      StringField s{ "TST2", 4 };
-                      std::memcpy(f->Data(), s.Data(), s.Size());
-                  })
-        .WillOnce([](Field* f)
-                  {  
-                      UInt32Field i{ 4 };
-                      std::memcpy(f->Data(), i.Data(), i.Size());
-                  });
+TEST_F(RawFileTests, FindsAllChunksWithID)
+{
+    InitializeTestFile();
+    ExpectChunkedStream({ "TST1", "TST2", "TST1" });
 
     ASSERT_NO_THROW(testFile->Open(BinData::FileMode::Read));
-    
-    std::shared_ptr<ChunkHeader> header = testFile->FindChunkHeader("TST2");
-    EXPECT_EQ(header->ID()->ToString(), "TST2");
-    EXPECT_EQ(header->Size()->Value(), 4);
+    std::vector<ChunkInfo> chunks = testFile->FindChunks("TST1");
+    ASSERT_EQ(chunks.size(), 2);
+    EXPECT_EQ(chunks[0].offset, 0);
+    EXPECT_EQ(chunks[1].offset, 24);
+    EXPECT_EQ(chunks[1].PayloadOffset(), 32);
+    EXPECT_EQ(chunks[1].size, 4);
+    EXPECT_EQ(testFile->Offset(), 0);
+    EXPECT_TRUE(testFile->FindChunks("TST3").empty());
 }
 
 TEST_F(RawFileTests, AppendsFileProperly)
@@ -626,4 +654,50 @@ TEST_F(RawFileTests, DoesNotAllowSettingOffsetBeyondFileSize)
         .WillRepeatedly(Return(12));
     
     EXPECT_THROW(testFile->SetOffset(13), BinData::InvalidFileOperation);
-}
\ No newline at end of file
+}
+TEST_F(RawFileTests, EnumeratesChunksLazily)
+{
+    InitializeTestFile();
+    ExpectChunkedStream();
+
+    ASSERT_NO_THROW(testFile->Open(BinData::FileMode::Read));
+    std::vector<ChunkInfo> chunks;
+    for (const ChunkInfo& chunk : testFile->Chunks())
+    {
+        // Each chunk is visited with the offset at its payload.
+        EXPECT_EQ(testFile->Offset(), chunk.PayloadOffset());
+        chunks.push_back(chunk);
+    }
+
+    ASSERT_EQ(chunks.size(), 3);
+    EXPECT_EQ(chunks[0].ID(), "TST1");
+    EXPECT_EQ(chunks[1].ID(), "TST2");
+    EXPECT_EQ(chunks[1].offset, 12);
+    EXPECT_EQ(chunks[2].ID(), "TST3");
+    EXPECT_EQ(chunks[2].size, 4);
+    EXPECT_EQ(testFile->Offset(), 36);
+}
+
+TEST_F(RawFileTests, StopsEnumeratingChunksEarly)
+{
+    InitializeTestFile();
+    ExpectChunkedStream();
+
+    // Only the headers that are actually visited should be read.
+    EXPECT_CALL(*mockStream, Read(_))
+        .Times(Exactly(2));
+
+    ASSERT_NO_THROW(testFile->Open(BinData::FileMode::Read));
+    std::string found;
+    for (const ChunkInfo& chunk : testFile->Chunks())
+    {
+        if (chunk.ID() == "TST2")
+        {
+            found = chunk.ID();
+            break;
+        }
+    }
+
+    EXPECT_EQ(found, "TST2");
+    EXPECT_EQ(testFile->Offset(), 20);
+}
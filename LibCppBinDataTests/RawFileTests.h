@@ -18,6 +18,7 @@
 #define RAW_FILE_TESTS_H
 
 #include <string>
+#include <vector>
 #include <memory>
 #include <gtest/gtest.h>
 #include "MockFileStream.h"
@@ -36,6 +37,8 @@ namespace BinData
         std::unique_ptr<BinData::RawFile> testFile;
         MockField mockField;
         MockFieldStruct mockFieldStruct;
+        std::vector<char> chunkData;
+        std::size_t chunkOffset;
 
         RawFileTests();
 
@@ -46,6 +49,9 @@ namespace BinData
         void ExpectOpened(BinData::FileMode m);
 
         void ExpectOpensAndClosesProperly(BinData::FileMode m);
+
+        void ExpectChunkedStream(std::vector<std::string> IDs = 
+            { "TST1", "TST2", "TST3" });
     };
 }
 
@@ -0,0 +1,57 @@
+// TestChunkFile.h - Declares helpers for creating chunked test files.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TEST_CHUNK_FILE_H
+#define TEST_CHUNK_FILE_H
+
+#include <string>
+#include <vector>
+#include <filesystem>
+#include "RawFile.h"
+#include "RawField.h"
+#include "ChunkHeader.h"
+
+/// @brief Writes a file made up of a flat sequence of chunks.
+///
+/// Each chunk gets the next ID and a payload of payloadSize bytes, where
+/// every byte of the payload is the chunk's index within the file.
+inline void WriteTestChunkFile(std::string fileName, 
+    std::vector<std::string> IDs, std::size_t payloadSize = 4)
+{
+    if (std::filesystem::exists(fileName))
+        std::filesystem::remove(fileName);
+
+    BinData::RawFile f{ fileName };
+    f.Open(BinData::FileMode::Write);
+    for (std::size_t i = 0; i < IDs.size(); i++)
+    {
+        BinData::ChunkHeader header;
+        header.ID()->SetData(IDs[i]);
+        header.Size()->SetValue(payloadSize);
+        f.Write(&header);
+
+        if (payloadSize > 0)
+        {
+            BinData::RawField payload{ payloadSize };
+            for (std::size_t j = 0; j < payloadSize; j++)
+                payload.Data()[j] = static_cast<char>(i);
+            f.Write(&payload);
+        }
+    }
+    f.Close();
+}
+
+#endif